@@ -0,0 +1,94 @@
+#include "gal_bench.hpp"
+
+#include <gal/cga.hpp>
+
+using namespace gal;
+using namespace gal::cga;
+
+namespace
+{
+template <typename T>
+point<T> random_point(gal_bench::source<T>& s)
+{
+    return {s(), s(), s()};
+}
+
+template <typename T>
+std::array<T, 5> construct(point<T> const& p)
+{
+    return {p.x, p.y, p.z, T{1}, T{0.5} * (p.x * p.x + p.y * p.y + p.z * p.z)};
+}
+
+template <typename T>
+std::array<T, 1> point_inner(point<T> const& p1, point<T> const& p2)
+{
+    T const dx = p1.x - p2.x;
+    T const dy = p1.y - p2.y;
+    T const dz = p1.z - p2.z;
+    return {T{-0.5} * (dx * dx + dy * dy + dz * dz)};
+}
+
+template <typename T>
+std::array<T, 9> line(point<T> const& p1, point<T> const& p2)
+{
+    T const a1 = T{0.5} - T{0.5} * (p1.x * p1.x + p1.y * p1.y + p1.z * p1.z);
+    T const a2 = T{0.5} - T{0.5} * (p2.x * p2.x + p2.y * p2.y + p2.z * p2.z);
+    T const cx = p1.y * p2.z - p1.z * p2.y;
+    T const cy = p1.z * p2.x - p1.x * p2.z;
+    T const cz = p1.x * p2.y - p1.y * p2.x;
+    return {p2.z * a1 - p1.z * a2,
+            p1.y * a2 - p2.y * a1,
+            p2.x * a1 - p1.x * a2,
+            -cx,
+            -cy,
+            -cz,
+            T{0.5} * cx,
+            T{0.5} * cy,
+            T{0.5} * cz};
+}
+
+template <typename T>
+void register_all()
+{
+    gal_bench::add<T>(
+        "cga",
+        "point",
+        std::array<unsigned, 5>{0b1, 0b10, 0b100, 0b1000, 0b10000},
+        [](point<T> const& p) { return compute([](auto p) { return p; }, p); },
+        construct<T>,
+        random_point<T>);
+
+    gal_bench::add<T>(
+        "cga",
+        "inner",
+        std::array<unsigned, 1>{0},
+        [](point<T> const& p1, point<T> const& p2) {
+            return compute([](auto p1, auto p2) { return p1 | p2; }, p1, p2);
+        },
+        point_inner<T>,
+        random_point<T>,
+        random_point<T>);
+
+    // The line through two points (outer product with the point at infinity) followed by a dual
+    gal_bench::add<T>(
+        "cga",
+        "line",
+        std::array<unsigned, 9>{
+            0b11, 0b101, 0b110, 0b1001, 0b1010, 0b1100, 0b10001, 0b10010, 0b10100},
+        [](point<T> const& p1, point<T> const& p2) {
+            return compute([](auto p1, auto p2) { return (p1 ^ p2 ^ 1_ni) >> 1_ips; }, p1, p2);
+        },
+        line<T>,
+        random_point<T>,
+        random_point<T>);
+}
+} // namespace
+
+namespace gal_bench
+{
+void register_cga()
+{
+    register_all<float>();
+    register_all<double>();
+}
+} // namespace gal_bench
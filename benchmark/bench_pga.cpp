@@ -0,0 +1,256 @@
+#include "gal_bench.hpp"
+
+#include <gal/pga.hpp>
+
+using namespace gal;
+using namespace gal::pga;
+
+namespace
+{
+template <typename T>
+plane<T> random_plane(gal_bench::source<T>& s)
+{
+    return {s(), s(), s(), s()};
+}
+
+template <typename T>
+line<T> random_line(gal_bench::source<T>& s)
+{
+    return {s(), s(), s(), s(), s(), s()};
+}
+
+template <typename T>
+point<T> random_point(gal_bench::source<T>& s)
+{
+    return {s(), s(), s(), T{1}};
+}
+
+template <typename T>
+motor<T> random_motor(gal_bench::source<T>& s)
+{
+    // Biased towards a positive scalar part so the motors are well away from the branch in log
+    return {T{2} + s(), s(), s(), s(), s(), s(), s(), s()};
+}
+
+template <typename T>
+motor<T> random_unit_motor(gal_bench::source<T>& s)
+{
+    motor<T> m = random_motor(s);
+    m.normalize();
+    return m;
+}
+
+template <typename T>
+std::array<T, 7> plane_product(plane<T> const& a, plane<T> const& b)
+{
+    return {a[1] * b[1] + a[2] * b[2] + a[3] * b[3],
+            a[0] * b[1] - a[1] * b[0],
+            a[0] * b[2] - a[2] * b[0],
+            a[1] * b[2] - a[2] * b[1],
+            a[0] * b[3] - a[3] * b[0],
+            a[1] * b[3] - a[3] * b[1],
+            a[2] * b[3] - a[3] * b[2]};
+}
+
+template <typename T>
+std::array<T, 6> plane_exterior(plane<T> const& a, plane<T> const& b)
+{
+    return {a[0] * b[1] - a[1] * b[0],
+            a[0] * b[2] - a[2] * b[0],
+            a[1] * b[2] - a[2] * b[1],
+            a[0] * b[3] - a[3] * b[0],
+            a[1] * b[3] - a[3] * b[1],
+            a[2] * b[3] - a[3] * b[2]};
+}
+
+template <typename T>
+std::array<T, 4> plane_line_inner(plane<T> const& a, line<T> const& l)
+{
+    return {a[1] * l[3] - a[2] * l[4] + a[3] * l[5],
+            a[2] * l[2] - a[3] * l[1],
+            a[3] * l[0] - a[1] * l[2],
+            a[1] * l[1] - a[2] * l[0]};
+}
+
+template <typename T>
+std::array<T, 4> sandwich(point<T> const& p, motor<T> const& m)
+{
+    T const m00 = m[0] * m[0];
+    T const m33 = m[3] * m[3];
+    T const m55 = m[5] * m[5];
+    T const m66 = m[6] * m[6];
+    T const m03 = m[0] * m[3];
+    T const m05 = m[0] * m[5];
+    T const m06 = m[0] * m[6];
+    T const m35 = m[3] * m[5];
+    T const m36 = m[3] * m[6];
+    T const m56 = m[5] * m[6];
+    return {p[0] * (m00 + m33 - m55 - m66) + 2 * p[1] * (m06 + m35) + 2 * p[2] * (m36 - m05)
+                + 2 * p[3] * (m[0] * m[4] - m[1] * m[5] - m[2] * m[6] + m[3] * m[7]),
+            2 * p[0] * (m35 - m06) + p[1] * (m00 - m33 + m55 - m66) + 2 * p[2] * (m03 + m56)
+                + 2 * p[3] * (m[1] * m[3] - m[0] * m[2] - m[4] * m[6] + m[5] * m[7]),
+            2 * p[0] * (m05 + m36) + 2 * p[1] * (m56 - m03) + p[2] * (m00 - m33 - m55 + m66)
+                + 2 * p[3] * (m[0] * m[1] + m[2] * m[3] + m[4] * m[5] + m[6] * m[7]),
+            p[3] * (m00 + m33 + m55 + m66)};
+}
+
+template <typename T>
+std::array<T, 8> motor_product(motor<T> const& a, motor<T> const& b)
+{
+    return {a[0] * b[0] - a[3] * b[3] - a[5] * b[5] - a[6] * b[6],
+            a[0] * b[1] + a[1] * b[0] - a[2] * b[3] + a[3] * b[2] - a[4] * b[5] + a[5] * b[4]
+                - a[6] * b[7] - a[7] * b[6],
+            a[0] * b[2] + a[1] * b[3] + a[2] * b[0] - a[3] * b[1] - a[4] * b[6] + a[5] * b[7]
+                + a[6] * b[4] + a[7] * b[5],
+            a[0] * b[3] + a[3] * b[0] - a[5] * b[6] + a[6] * b[5],
+            a[0] * b[4] + a[1] * b[5] + a[2] * b[6] - a[3] * b[7] + a[4] * b[0] - a[5] * b[1]
+                - a[6] * b[2] - a[7] * b[3],
+            a[0] * b[5] + a[3] * b[6] + a[5] * b[0] - a[6] * b[3],
+            a[0] * b[6] - a[3] * b[5] + a[5] * b[3] + a[6] * b[0],
+            a[0] * b[7] + a[1] * b[6] - a[2] * b[5] + a[3] * b[4] + a[4] * b[3] - a[5] * b[2]
+                + a[6] * b[1] + a[7] * b[0]};
+}
+
+template <typename T>
+std::array<T, 6> motor_log(motor<T> const& m)
+{
+    using std::abs;
+    using std::atan2;
+    using std::sqrt;
+
+    T const s1 = m[0];
+    T const p1 = m[7];
+
+    // The bivector part squares to s2^2 + 2 s2 p2 I
+    T const l2_0 = -(m[3] * m[3] + m[5] * m[5] + m[6] * m[6]);
+    T const l2_4 = 2 * (m[1] * m[6] - m[2] * m[5] + m[3] * m[4]);
+    T const s2   = sqrt(-l2_0);
+    T const p2   = -l2_4 / (2 * s2);
+
+    bool const s1_zero = abs(s1) < T{1e-6};
+    T const u          = s1_zero ? atan2(-p1, p2) : atan2(s2, s1);
+    T const v          = s1_zero ? -p1 / s2 : p2 / s1;
+
+    // (u + v I) times the inverse norm 1 / s2 + p2 / l2_0 I
+    T const a = u / s2;
+    T const b = u * p2 / l2_0 + v / s2;
+    return {a * m[1] - b * m[6],
+            a * m[2] + b * m[5],
+            a * m[3],
+            a * m[4] - b * m[3],
+            a * m[5],
+            a * m[6]};
+}
+
+template <typename T>
+std::array<T, 8> motor_normalize(motor<T> const& m)
+{
+    using std::sqrt;
+
+    T const u      = m[0] * m[0] + m[3] * m[3] + m[5] * m[5] + m[6] * m[6];
+    T const v      = 2 * (m[0] * m[7] - m[1] * m[6] + m[2] * m[5] - m[3] * m[4]);
+    T const sqrt_u = sqrt(u);
+    T const a      = T{1} / sqrt_u;
+    T const b      = -v / (2 * sqrt_u * u);
+    return {m[0] * a,
+            m[1] * a - m[6] * b,
+            m[2] * a + m[5] * b,
+            m[3] * a,
+            m[4] * a - m[3] * b,
+            m[5] * a,
+            m[6] * a,
+            m[0] * b + m[7] * a};
+}
+
+constexpr std::array<unsigned, 8> motor_elements{
+    0, 0b11, 0b101, 0b110, 0b1001, 0b1010, 0b1100, 0b1111};
+constexpr std::array<unsigned, 6> line_elements{0b11, 0b101, 0b110, 0b1001, 0b1010, 0b1100};
+
+template <typename T>
+void register_all()
+{
+    gal_bench::add<T>(
+        "pga",
+        "geometric",
+        std::array<unsigned, 7>{0, 0b11, 0b101, 0b110, 0b1001, 0b1010, 0b1100},
+        [](plane<T> const& a, plane<T> const& b) {
+            return compute([](auto a, auto b) { return a * b; }, a, b);
+        },
+        plane_product<T>,
+        random_plane<T>,
+        random_plane<T>);
+
+    gal_bench::add<T>(
+        "pga",
+        "exterior",
+        line_elements,
+        [](plane<T> const& a, plane<T> const& b) {
+            return compute([](auto a, auto b) { return a ^ b; }, a, b);
+        },
+        plane_exterior<T>,
+        random_plane<T>,
+        random_plane<T>);
+
+    gal_bench::add<T>(
+        "pga",
+        "inner",
+        std::array<unsigned, 4>{0b1, 0b10, 0b100, 0b1000},
+        [](plane<T> const& a, line<T> const& l) {
+            return compute([](auto a, auto l) { return a | l; }, a, l);
+        },
+        plane_line_inner<T>,
+        random_plane<T>,
+        random_line<T>);
+
+    gal_bench::add<T>(
+        "pga",
+        "sandwich",
+        std::array<unsigned, 4>{0b111, 0b1011, 0b1101, 0b1110},
+        [](point<T> const& p, motor<T> const& m) {
+            return compute([](auto p, auto m) { return m * p * ~m; }, p, m);
+        },
+        sandwich<T>,
+        random_point<T>,
+        random_unit_motor<T>);
+
+    gal_bench::add<T>(
+        "pga",
+        "motor_compose",
+        motor_elements,
+        [](motor<T> const& a, motor<T> const& b) {
+            return compute([](auto a, auto b) { return a * b; }, a, b);
+        },
+        motor_product<T>,
+        random_unit_motor<T>,
+        random_unit_motor<T>);
+
+    gal_bench::add<T>(
+        "pga",
+        "motor_log",
+        line_elements,
+        [](motor<T> const& m) { return m.log(); },
+        motor_log<T>,
+        random_unit_motor<T>);
+
+    gal_bench::add<T>(
+        "pga",
+        "motor_normalize",
+        motor_elements,
+        [](motor<T> m) {
+            m.normalize();
+            return entity<pga_algebra, T, 0, 0b11, 0b101, 0b110, 0b1001, 0b1010, 0b1100, 0b1111>{
+                m[0], m[1], m[2], m[3], m[4], m[5], m[6], m[7]};
+        },
+        motor_normalize<T>,
+        random_motor<T>);
+}
+} // namespace
+
+namespace gal_bench
+{
+void register_pga()
+{
+    register_all<float>();
+    register_all<double>();
+}
+} // namespace gal_bench
@@ -0,0 +1,82 @@
+#include "gal_bench.hpp"
+
+#include <gal/pga2.hpp>
+
+using namespace gal;
+using namespace gal::pga2;
+
+namespace
+{
+template <typename T>
+line<T> random_line(gal_bench::source<T>& s)
+{
+    return {s(), s(), s()};
+}
+
+template <typename T>
+std::array<T, 4> line_product(line<T> const& a, line<T> const& b)
+{
+    return {a[1] * b[1] + a[2] * b[2],
+            a[0] * b[1] - a[1] * b[0],
+            a[0] * b[2] - a[2] * b[0],
+            a[1] * b[2] - a[2] * b[1]};
+}
+
+template <typename T>
+std::array<T, 3> line_exterior(line<T> const& a, line<T> const& b)
+{
+    return {a[0] * b[1] - a[1] * b[0], a[0] * b[2] - a[2] * b[0], a[1] * b[2] - a[2] * b[1]};
+}
+
+template <typename T>
+std::array<T, 1> line_inner(line<T> const& a, line<T> const& b)
+{
+    return {a[1] * b[1] + a[2] * b[2]};
+}
+
+template <typename T>
+void register_all()
+{
+    gal_bench::add<T>(
+        "pga2",
+        "geometric",
+        std::array<unsigned, 4>{0, 0b11, 0b101, 0b110},
+        [](line<T> const& a, line<T> const& b) {
+            return compute([](auto a, auto b) { return a * b; }, a, b);
+        },
+        line_product<T>,
+        random_line<T>,
+        random_line<T>);
+
+    gal_bench::add<T>(
+        "pga2",
+        "exterior",
+        std::array<unsigned, 3>{0b11, 0b101, 0b110},
+        [](line<T> const& a, line<T> const& b) {
+            return compute([](auto a, auto b) { return a ^ b; }, a, b);
+        },
+        line_exterior<T>,
+        random_line<T>,
+        random_line<T>);
+
+    gal_bench::add<T>(
+        "pga2",
+        "inner",
+        std::array<unsigned, 1>{0},
+        [](line<T> const& a, line<T> const& b) {
+            return compute([](auto a, auto b) { return a | b; }, a, b);
+        },
+        line_inner<T>,
+        random_line<T>,
+        random_line<T>);
+}
+} // namespace
+
+namespace gal_bench
+{
+void register_pga2()
+{
+    register_all<float>();
+    register_all<double>();
+}
+} // namespace gal_bench
@@ -0,0 +1,147 @@
+#include "gal_bench.hpp"
+
+#include <gal/vga.hpp>
+
+using namespace gal;
+using namespace gal::vga;
+
+namespace
+{
+template <typename T>
+gal::vga::vector<T> random_vector(gal_bench::source<T>& s)
+{
+    return {s(), s(), s()};
+}
+
+template <typename T>
+rotor<T> random_rotor(gal_bench::source<T>& s)
+{
+    rotor<T> r{T{3.14159265358979323846} * s(), s(), s(), s()};
+    r.normalize();
+    return r;
+}
+
+template <typename T>
+std::array<T, 4> vector_product(gal::vga::vector<T> const& a, gal::vga::vector<T> const& b)
+{
+    return {a[0] * b[0] + a[1] * b[1] + a[2] * b[2],
+            a[0] * b[1] - a[1] * b[0],
+            a[0] * b[2] - a[2] * b[0],
+            a[1] * b[2] - a[2] * b[1]};
+}
+
+template <typename T>
+std::array<T, 3> vector_exterior(gal::vga::vector<T> const& a, gal::vga::vector<T> const& b)
+{
+    return {a[0] * b[1] - a[1] * b[0], a[0] * b[2] - a[2] * b[0], a[1] * b[2] - a[2] * b[1]};
+}
+
+template <typename T>
+std::array<T, 1> vector_inner(gal::vga::vector<T> const& a, gal::vga::vector<T> const& b)
+{
+    return {a[0] * b[0] + a[1] * b[1] + a[2] * b[2]};
+}
+
+template <typename T>
+std::array<T, 3> sandwich(gal::vga::vector<T> const& v, rotor<T> const& r)
+{
+    // Rotation by the equivalent unit quaternion (w, q)
+    T const w  = r.cos_theta;
+    T const qx = r.sin_theta * r.x;
+    T const qy = r.sin_theta * r.y;
+    T const qz = r.sin_theta * r.z;
+    T const ww = w * w;
+    T const xx = qx * qx;
+    T const yy = qy * qy;
+    T const zz = qz * qz;
+    return {v[0] * (ww + xx - yy - zz) + 2 * v[1] * (qx * qy - w * qz)
+                + 2 * v[2] * (qx * qz + w * qy),
+            v[1] * (ww - xx + yy - zz) + 2 * v[0] * (qx * qy + w * qz)
+                + 2 * v[2] * (qy * qz - w * qx),
+            v[2] * (ww - xx - yy + zz) + 2 * v[0] * (qx * qz - w * qy)
+                + 2 * v[1] * (qy * qz + w * qx)};
+}
+
+template <typename T>
+std::array<T, 4> rotor_product(rotor<T> const& a, rotor<T> const& b)
+{
+    T const s = a.sin_theta * b.sin_theta;
+    return {a.cos_theta * b.cos_theta - s * (a.x * b.x + a.y * b.y + a.z * b.z),
+            -a.cos_theta * b.sin_theta * b.z - a.sin_theta * a.z * b.cos_theta
+                - s * (a.x * b.y - a.y * b.x),
+            a.cos_theta * b.sin_theta * b.y + a.sin_theta * a.y * b.cos_theta
+                - s * (a.x * b.z - a.z * b.x),
+            -a.cos_theta * b.sin_theta * b.x - a.sin_theta * a.x * b.cos_theta
+                - s * (a.y * b.z - a.z * b.y)};
+}
+
+template <typename T>
+void register_all()
+{
+    using vec = gal::vga::vector<T>;
+
+    gal_bench::add<T>(
+        "vga",
+        "geometric",
+        std::array<unsigned, 4>{0, 0b11, 0b101, 0b110},
+        [](vec const& a, vec const& b) {
+            return compute([](auto a, auto b) { return a * b; }, a, b);
+        },
+        vector_product<T>,
+        random_vector<T>,
+        random_vector<T>);
+
+    gal_bench::add<T>(
+        "vga",
+        "exterior",
+        std::array<unsigned, 3>{0b11, 0b101, 0b110},
+        [](vec const& a, vec const& b) {
+            return compute([](auto a, auto b) { return a ^ b; }, a, b);
+        },
+        vector_exterior<T>,
+        random_vector<T>,
+        random_vector<T>);
+
+    gal_bench::add<T>(
+        "vga",
+        "inner",
+        std::array<unsigned, 1>{0},
+        [](vec const& a, vec const& b) {
+            return compute([](auto a, auto b) { return a | b; }, a, b);
+        },
+        vector_inner<T>,
+        random_vector<T>,
+        random_vector<T>);
+
+    gal_bench::add<T>(
+        "vga",
+        "sandwich",
+        std::array<unsigned, 3>{0b1, 0b10, 0b100},
+        [](vec const& v, rotor<T> const& r) {
+            return compute([](auto v, auto r) { return r * v * ~r; }, v, r);
+        },
+        sandwich<T>,
+        random_vector<T>,
+        random_rotor<T>);
+
+    gal_bench::add<T>(
+        "vga",
+        "rotor_compose",
+        std::array<unsigned, 4>{0, 0b11, 0b101, 0b110},
+        [](rotor<T> const& a, rotor<T> const& b) {
+            return compute([](auto a, auto b) { return a * b; }, a, b);
+        },
+        rotor_product<T>,
+        random_rotor<T>,
+        random_rotor<T>);
+}
+} // namespace
+
+namespace gal_bench
+{
+void register_vga()
+{
+    register_all<float>();
+    register_all<double>();
+}
+} // namespace gal_bench
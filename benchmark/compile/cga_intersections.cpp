@@ -0,0 +1,35 @@
+// Construction and intersection of CGA rounds and flats: a dual sphere from its center and
+// radius, a plane through three points and a line through two, then the circle where the plane
+// cuts the sphere and the point pair where the line pierces it (as dual entities).
+
+#include <gal/cga.hpp>
+
+using namespace gal;
+using namespace gal::cga;
+
+using sc = scalar<cga_algebra, float>;
+
+auto sphere(point<float> const& center, float radius)
+{
+    return compute([](auto c, auto r) { return c - r * r * 1_ni / 2; }, center, sc{radius});
+}
+
+auto circle(point<float> const& center,
+            float radius,
+            point<float> const& q1,
+            point<float> const& q2,
+            point<float> const& q3)
+{
+    auto plane = compute(
+        [](auto q1, auto q2, auto q3) { return q1 ^ q2 ^ q3 ^ 1_ni; }, q1, q2, q3);
+    return compute([](auto s, auto plane) { return s ^ !plane; }, sphere(center, radius), plane);
+}
+
+auto point_pair(point<float> const& center,
+                float radius,
+                point<float> const& l1,
+                point<float> const& l2)
+{
+    auto line = compute([](auto l1, auto l2) { return l1 ^ l2 ^ 1_ni; }, l1, l2);
+    return compute([](auto s, auto line) { return s ^ !line; }, sphere(center, radius), line);
+}
@@ -0,0 +1,200 @@
+#!/usr/bin/env python3
+"""Compile-time regression benchmark for GAL.
+
+Compiles each translation unit of the gal_compile_bench target on its own, using the exact
+command recorded in the build's compile_commands.json, and records for each one:
+
+  wall_seconds    wall clock time of the compilation (median over --repeat runs)
+  peak_rss_kb     peak resident set size of the compiler
+  instantiations  template instantiations (clang: InstantiateFunction/InstantiateClass events
+                  from -ftime-trace; GCC: function template specializations listed by -Q)
+  object_bytes    size of the resulting object file
+
+Instantiations are counted in an extra, separate compilation so that the timed runs are not
+perturbed by the additional output. Results are written as JSON. When a baseline produced by a
+previous run is supplied, any metric that grew by more than the threshold is reported and the
+script exits with a non-zero status.
+
+Usage: compile_bench.py --build-dir <dir> [--output <file>] [--repeat <n>]
+                        [--baseline <file>] [--threshold <percent>]
+"""
+
+import argparse
+import datetime
+import json
+import os
+import shlex
+import statistics
+import subprocess
+import sys
+import tempfile
+import time
+
+SOURCE_DIR = os.path.dirname(os.path.abspath(__file__))
+METRICS = ["wall_seconds", "peak_rss_kb", "instantiations", "object_bytes"]
+
+
+def load_commands(build_dir):
+    path = os.path.join(build_dir, "compile_commands.json")
+    if not os.path.exists(path):
+        sys.exit(f"{path} not found (configure with -DGAL_BENCHMARKS_ENABLED=ON first)")
+    with open(path) as f:
+        entries = json.load(f)
+
+    commands = []
+    for entry in entries:
+        source = os.path.normpath(os.path.join(entry["directory"], entry["file"]))
+        if os.path.dirname(source) != SOURCE_DIR:
+            continue
+        args = entry.get("arguments") or shlex.split(entry["command"])
+        commands.append((source, entry["directory"], args))
+    if not commands:
+        sys.exit(f"no gal_compile_bench sources in {path}")
+    return sorted(commands)
+
+
+def with_output(args, output):
+    out = list(args)
+    index = out.index("-o")
+    out[index + 1] = output
+    return out
+
+
+def is_clang(args):
+    version = subprocess.run([args[0], "--version"], capture_output=True, text=True).stdout
+    return "clang" in version
+
+
+def run(args, cwd):
+    """Runs a compilation and returns (wall seconds, peak RSS in KiB, stderr)."""
+    start = time.perf_counter()
+    proc = subprocess.Popen(args, cwd=cwd, stdout=subprocess.DEVNULL, stderr=subprocess.PIPE)
+    stderr = proc.stderr.read()
+    # The rusage of the driver includes the compiler processes it waited on
+    _, status, usage = os.wait4(proc.pid, 0)
+    wall = time.perf_counter() - start
+    if os.waitstatus_to_exitcode(status) != 0:
+        sys.exit(f"compilation failed: {shlex.join(args)}\n{stderr.decode(errors='replace')}")
+    rss = usage.ru_maxrss if sys.platform != "darwin" else usage.ru_maxrss // 1024
+    return wall, rss, stderr.decode(errors="replace")
+
+
+def count_instantiations(args, cwd, clang, scratch):
+    output = os.path.join(scratch, "instantiations.o")
+    if clang:
+        run(with_output(args, output) + ["-ftime-trace", "-ftime-trace-granularity=0"], cwd)
+        with open(os.path.splitext(output)[0] + ".json") as f:
+            events = json.load(f)["traceEvents"]
+        kinds = ("InstantiateFunction", "InstantiateClass")
+        return sum(1 for e in events if e.get("name") in kinds)
+
+    # GCC lists every function as it is parsed (before "Analyzing compilation unit"), with
+    # template specializations annotated by their arguments
+    _, _, stderr = run(with_output(args, output) + ["-Q"], cwd)
+    parsed = stderr.split("Analyzing compilation unit")[0]
+    return parsed.count("[with ")
+
+
+def measure(source, cwd, args, repeat, clang, scratch):
+    name = os.path.splitext(os.path.basename(source))[0]
+    output = os.path.join(scratch, name + ".o")
+    walls = []
+    peak = 0
+    for _ in range(repeat):
+        wall, rss, _ = run(with_output(args, output), cwd)
+        walls.append(wall)
+        peak = max(peak, rss)
+    return {
+        "name": name,
+        "source": os.path.relpath(source, os.path.dirname(os.path.dirname(SOURCE_DIR))),
+        "wall_seconds": round(statistics.median(walls), 3),
+        "peak_rss_kb": peak,
+        "instantiations": count_instantiations(args, cwd, clang, scratch),
+        "object_bytes": os.path.getsize(output),
+    }
+
+
+def commit():
+    try:
+        return subprocess.run(
+            ["git", "rev-parse", "HEAD"], cwd=SOURCE_DIR, capture_output=True, text=True, check=True
+        ).stdout.strip()
+    except (OSError, subprocess.CalledProcessError):
+        return None
+
+
+def compare(results, baseline, threshold):
+    """Prints the change of every metric against the baseline and returns the regressions."""
+    previous = {r["name"]: r for r in baseline["results"]}
+    regressions = []
+    print(f"\nChange relative to baseline ({baseline.get('commit') or 'unknown commit'}):")
+    for r in results:
+        old = previous.get(r["name"])
+        if old is None:
+            print(f"  {r['name']}: not in baseline")
+            continue
+        changes = []
+        for metric in METRICS:
+            if not old.get(metric):
+                continue
+            delta = 100.0 * (r[metric] - old[metric]) / old[metric]
+            changes.append(f"{metric} {delta:+.1f}%")
+            if delta > threshold:
+                regressions.append((r["name"], metric, old[metric], r[metric], delta))
+        print(f"  {r['name']}: " + ", ".join(changes))
+    return regressions
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    parser.add_argument(
+        "--build-dir", required=True, help="build directory with compile_commands.json"
+    )
+    parser.add_argument("--output", default="compile_bench.json", help="results file to write")
+    parser.add_argument("--repeat", type=int, default=3, help="timed compilations per TU")
+    parser.add_argument("--baseline", help="results of a previous run to compare against")
+    parser.add_argument("--threshold", type=float, default=10.0, help="regression threshold (%%)")
+    options = parser.parse_args()
+
+    commands = load_commands(os.path.abspath(options.build_dir))
+    clang = is_clang(commands[0][2])
+
+    results = []
+    with tempfile.TemporaryDirectory() as scratch:
+        for source, cwd, args in commands:
+            result = measure(source, cwd, args, options.repeat, clang, scratch)
+            results.append(result)
+            print(
+                f"{result['name']:20} {result['wall_seconds']:8.2f} s"
+                f" {result['peak_rss_kb'] / 1024:8.1f} MiB"
+                f" {result['instantiations']:8} inst {result['object_bytes']:10} B",
+                flush=True,
+            )
+
+    report = {
+        "compiler": subprocess.run(
+            [commands[0][2][0], "--version"], capture_output=True, text=True
+        ).stdout.splitlines()[0],
+        "commit": commit(),
+        "date": datetime.datetime.now(datetime.timezone.utc).isoformat(timespec="seconds"),
+        "repeat": options.repeat,
+        "results": results,
+    }
+    with open(options.output, "w") as f:
+        json.dump(report, f, indent=2)
+        f.write("\n")
+
+    if options.baseline:
+        with open(options.baseline) as f:
+            baseline = json.load(f)
+        regressions = compare(results, baseline, options.threshold)
+        if regressions:
+            print(f"\n{len(regressions)} regression(s) above {options.threshold}%:")
+            for name, metric, old, new, delta in regressions:
+                print(f"  {name} {metric}: {old} -> {new} ({delta:+.1f}%)")
+            return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,44 @@
+// A long VGA lambda of several hundred nodes built from every pairing of eight vectors, each
+// pairing reusing its geometric product. The polynomials stay small, so the cost is dominated by
+// the discovery of common subexpressions in rpn_reshape rather than by expansion.
+
+#include <gal/vga.hpp>
+
+using namespace gal;
+using namespace gal::vga;
+
+namespace
+{
+template <typename V, typename... Vs>
+constexpr auto pairings(V const& v, Vs const&... vs)
+{
+    return (((v * vs) + (v ^ vs) + (v | vs) * (v * vs)) + ...);
+}
+} // namespace
+
+using vec = gal::vga::vector<float>;
+
+auto cse_heavy(vec const& v0,
+               vec const& v1,
+               vec const& v2,
+               vec const& v3,
+               vec const& v4,
+               vec const& v5,
+               vec const& v6,
+               vec const& v7)
+{
+    return compute(
+        [](auto v0, auto v1, auto v2, auto v3, auto v4, auto v5, auto v6, auto v7) {
+            return pairings(v0, v1, v2, v3, v4, v5, v6, v7) + pairings(v1, v2, v3, v4, v5, v6, v7)
+                   + pairings(v2, v3, v4, v5, v6, v7) + pairings(v3, v4, v5, v6, v7)
+                   + pairings(v4, v5, v6, v7) + pairings(v5, v6, v7) + pairings(v6, v7);
+        },
+        v0,
+        v1,
+        v2,
+        v3,
+        v4,
+        v5,
+        v6,
+        v7);
+}
@@ -0,0 +1,61 @@
+// The opening stages of the ga-benchmark CGA inverse kinematics algorithm (see
+// ../ga-benchmark/SpecializedAlgorithmInverseKinematics.hpp): a chain of dependent computes
+// building rotors from lines, each exponentiated with a fourth order expansion. The later stages
+// returning tuples of results are omitted as they don't currently build with GCC.
+
+#include <gal/cga.hpp>
+
+using namespace gal;
+using namespace gal::cga;
+
+namespace
+{
+template <typename T>
+auto expp(T const& arg)
+{
+    auto arg2 = compute([](auto arg) { return arg * arg; }, arg);
+    return compute(
+        [](auto arg, auto arg2) {
+            auto arg3 = arg * arg2;
+            auto arg4 = arg2 * arg2;
+            return 1 + arg + arg2 / 2 + arg3 / 6 + arg4 / 24;
+        },
+        arg,
+        arg2);
+}
+} // namespace
+
+auto inverse_kinematics(double ang1, double ang2, double ang3)
+{
+    using sc = scalar<cga_algebra, double>;
+
+    point<double> J1{200.0, 0.0, 680.0};
+    point<double> J2{200.0, 0.0, 1570.0};
+
+    auto Lz = compute(
+        [](auto ang1) { return ((1_no ^ (1_no + 1_e3 + 1_ni / 2) ^ 1_ni) >> 1_ips) * ang1 / 2; },
+        sc{ang1});
+    auto R1 = expp(Lz);
+
+    point<double> P2_help{J1.x, J1.y + 1.0, J1.z};
+    auto L2 = compute(
+        [](auto R1, auto J1, auto P2_help, auto ang2) {
+            auto L2init = (J1 ^ P2_help ^ 1_ni) >> 1_ips;
+            return (L2init % R1) * ang2 / 2;
+        },
+        R1,
+        J1,
+        P2_help,
+        sc{ang2});
+    auto R2 = expp(L2);
+
+    point<double> P3_help{J2.x, J2.y + 1.0, J2.z};
+    auto R21 = compute([](auto R1, auto R2) { return R2 * R1; }, R1, R2);
+    auto L3init = compute(
+        [](auto J2, auto P3_help) { return (J2 ^ P3_help ^ 1_ni) >> 1_ips; }, J2, P3_help);
+    auto L3 = compute([](auto L3init, auto R21, auto ang3) { return (L3init % R21) * ang3 / 2; },
+                      L3init,
+                      R21,
+                      sc{ang3});
+    return expp(L3);
+}
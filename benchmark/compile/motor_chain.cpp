@@ -0,0 +1,38 @@
+// A chain of motors composed pairwise across dependent computes and then applied to a point, as
+// in forward kinematics of an articulated chain, followed by a single compute composing four
+// motors at once. Stresses the size of intermediate expressions.
+
+#include <gal/pga.hpp>
+
+using namespace gal;
+using namespace gal::pga;
+
+auto motor_chain(point<float> const& p, motor<float> const (&m)[8])
+{
+    auto compose = [](auto a, auto b) { return a * b; };
+
+    motor<float> chain = m[0];
+    for (size_t i = 1; i != 8; ++i)
+    {
+        chain = compute(compose, chain, m[i]);
+    }
+    return compute([](auto p, auto m) { return m * p * ~m; }, p, chain);
+}
+
+auto motor_chain4(point<float> const& p,
+                  motor<float> const& m1,
+                  motor<float> const& m2,
+                  motor<float> const& m3,
+                  motor<float> const& m4)
+{
+    return compute(
+        [](auto p, auto m1, auto m2, auto m3, auto m4) {
+            auto m = m1 * m2 * m3 * m4;
+            return m * p * ~m;
+        },
+        p,
+        m1,
+        m2,
+        m3,
+        m4);
+}
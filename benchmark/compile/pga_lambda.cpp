@@ -0,0 +1,38 @@
+// A single PGA lambda of twenty operations mixing the geometric, exterior, inner and regressive
+// products with sandwiches, reversion and scalar arithmetic, representative of a larger
+// user-written expression.
+
+#include <gal/pga.hpp>
+
+using namespace gal;
+using namespace gal::pga;
+
+auto pga_lambda(plane<float> const& a,
+                plane<float> const& b,
+                plane<float> const& c,
+                point<float> const& p,
+                line<float> const& l,
+                motor<float> const& m)
+{
+    return compute(
+        [](auto a, auto b, auto c, auto p, auto l, auto m) {
+            auto ab    = a ^ b;                  // 1
+            auto x     = ab ^ c;                 // 2
+            auto moved = m % p;                  // 3
+            auto proj  = (a | l) * a;            // 4, 5
+            auto rl    = m % l;                  // 6
+            auto ortho = (l | a) ^ b;            // 7, 8
+            auto diff  = moved - x;              // 9
+            auto mid   = (moved + p) / 2;        // 10, 11
+            auto join  = mid & l;                // 12
+            auto d     = ab | c;                 // 13
+            auto s     = 2 * ortho;              // 14
+            return join + d + s - proj + ~rl + (diff & l); // 15, 16, 17, 18, 19, 20
+        },
+        a,
+        b,
+        c,
+        p,
+        l,
+        m);
+}
@@ -0,0 +1,41 @@
+// Microbenchmarks of the core operations of each algebra, timed both through GAL and through a
+// handwritten baseline. Results from GAL are checked against the baselines before any timing
+// starts, and the run aborts if any pair disagrees.
+//
+// Usage: gal_bench [google benchmark flags]
+//
+// For comparisons across commits, record results with --benchmark_out=<file>.json
+// --benchmark_out_format=json and compare them with google benchmark's tools/compare.py.
+
+#include "gal_bench.hpp"
+
+namespace gal_bench
+{
+int& failures() noexcept
+{
+    static int count = 0;
+    return count;
+}
+} // namespace gal_bench
+
+int main(int argc, char** argv)
+{
+    gal_bench::register_pga();
+    gal_bench::register_pga2();
+    gal_bench::register_vga();
+    gal_bench::register_cga();
+    if (gal_bench::failures() != 0)
+    {
+        std::fprintf(stderr, "%d benchmark(s) failed validation\n", gal_bench::failures());
+        return 1;
+    }
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv))
+    {
+        return 1;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
@@ -0,0 +1,145 @@
+#pragma once
+
+// Shared harness for gal_bench. Every operation is registered twice, once evaluated with GAL's
+// compute and once with a handwritten baseline performing the same arithmetic, so the reported
+// times can be compared directly. Each benchmark iteration evaluates a single operation on the
+// next input of a fixed, seeded pool, so the reported time is the time per operation and runs are
+// comparable across commits.
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <random>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace gal_bench
+{
+// Number of distinct inputs cycled through (a power of two, small enough to stay resident in L1)
+constexpr size_t pool_size = 256;
+
+// Number of inputs from the pool on which the GAL result is compared against the baseline
+constexpr size_t validation_count = 64;
+
+template <typename T>
+constexpr char const* type_name() noexcept
+{
+    return sizeof(T) == sizeof(float) ? "float" : "double";
+}
+
+template <typename T>
+constexpr T tolerance() noexcept
+{
+    return sizeof(T) == sizeof(float) ? T{1e-4} : T{1e-9};
+}
+
+// Uniformly distributed values in [-1, 1] from a fixed seed
+template <typename T>
+class source
+{
+public:
+    explicit source(uint32_t seed)
+        : engine_{seed}
+    {}
+
+    T operator()()
+    {
+        return std::uniform_real_distribution<T>{T{-1}, T{1}}(engine_);
+    }
+
+private:
+    std::mt19937 engine_;
+};
+
+// Registered validation failures are counted here and reported by main before any timing starts
+int& failures() noexcept;
+
+template <typename T, size_t N>
+bool approx_equal(std::array<T, N> const& lhs, std::array<T, N> const& rhs)
+{
+    for (size_t i = 0; i != N; ++i)
+    {
+        using std::abs;
+        T const scale = std::max({T{1}, abs(lhs[i]), abs(rhs[i])});
+        if (!(abs(lhs[i] - rhs[i]) <= tolerance<T>() * scale))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Registers "<algebra>/<operation>/gal/<type>" and "<algebra>/<operation>/baseline/<type>".
+//
+// The GAL operation returns an entity while the baseline returns the same components as a
+// std::array ordered as in `elements`. Each input argument is generated per pool entry by calling
+// the corresponding generator with a source<T>.
+template <typename T, size_t N, typename G, typename B, typename... Gen>
+void add(char const* algebra,
+         char const* operation,
+         std::array<unsigned, N> const& elements,
+         G gal_op,
+         B baseline_op,
+         Gen... generate)
+{
+    using inputs_t = std::tuple<decltype(generate(std::declval<source<T>&>()))...>;
+    auto pool      = std::make_shared<std::vector<inputs_t>>();
+    pool->reserve(pool_size);
+    source<T> s{0x9e3779b9u};
+    for (size_t i = 0; i != pool_size; ++i)
+    {
+        // Braced initialization guarantees the generators are invoked left to right
+        pool->push_back(inputs_t{generate(s)...});
+    }
+
+    std::string const prefix = std::string{algebra} + '/' + operation + '/';
+    for (size_t i = 0; i != validation_count; ++i)
+    {
+        auto const entity = std::apply(gal_op, (*pool)[i]);
+        std::array<T, N> actual;
+        for (size_t j = 0; j != N; ++j)
+        {
+            actual[j] = entity.select(elements[j]);
+        }
+        std::array<T, N> const expected = std::apply(baseline_op, (*pool)[i]);
+        if (!approx_equal(actual, expected))
+        {
+            std::fprintf(stderr,
+                         "%s%s: GAL and baseline disagree on input %zu\n",
+                         prefix.c_str(),
+                         type_name<T>(),
+                         i);
+            ++failures();
+            break;
+        }
+    }
+
+    auto run = [pool](benchmark::State& state, auto op) {
+        size_t i = 0;
+        for (auto _ : state)
+        {
+            auto out = std::apply(op, (*pool)[i]);
+            benchmark::DoNotOptimize(out);
+            i = (i + 1) & (pool_size - 1);
+        }
+        state.SetItemsProcessed(state.iterations());
+    };
+    benchmark::RegisterBenchmark((prefix + "gal/" + type_name<T>()).c_str(),
+                                 [run, gal_op](benchmark::State& state) { run(state, gal_op); });
+    benchmark::RegisterBenchmark(
+        (prefix + "baseline/" + type_name<T>()).c_str(),
+        [run, baseline_op](benchmark::State& state) { run(state, baseline_op); });
+}
+
+void register_pga();
+void register_pga2();
+void register_vga();
+void register_cga();
+} // namespace gal_bench
@@ -0,0 +1,120 @@
+// Inverse kinematics benchmark. Solves a four joint arm for each of many rigs with a distinct
+// target, comparing a batched solve (one rig per SIMD lane) against solving the rigs one at a time.
+// Every solve starts from the rest pose.
+//
+// Usage: gal_ik_bench [rig count] [max iterations]
+
+#include <gal/ik.hpp>
+#include <gal/thread_pool.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+using namespace gal;
+using namespace gal::pga;
+
+using pnt = gal::vga::point<float>;
+
+template <typename F>
+double time_us(F&& f)
+{
+    // Warm up (spins up any workers)
+    f();
+
+    constexpr int iterations = 20;
+    auto start               = std::chrono::steady_clock::now();
+    for (int i = 0; i != iterations; ++i)
+    {
+        f();
+    }
+    std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count() / iterations;
+}
+
+int main(int argc, char** argv)
+{
+    size_t const rigs = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 512;
+    ik_settings<> settings;
+    settings.max_iterations = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 16;
+
+    // Shoulder, elbow, wrist and hand, with a shoulder which may only swing by 90 degrees
+    constexpr size_t joints = 4;
+    std::vector<float> limits{1.57f, 2.5f, 1.2f, 0.8f};
+    motor<> const rest{1, 0, 0, 0, 0, 0, 0, 0};
+
+    std::vector<motor<>> offsets;
+    std::vector<pnt> effectors;
+    std::vector<pnt> targets;
+    for (size_t r = 0; r != rigs; ++r)
+    {
+        float t = static_cast<float>(r) / rigs;
+        // Translations placing each rig along a line, then spacing the joints along x
+        offsets.push_back({1, 0, -0.5f * t * 10.0f, 0, 0, 0, 0, 0});
+        offsets.push_back({1, -0.15f, 0, 0, 0, 0, 0, 0});
+        offsets.push_back({1, -0.13f, 0, 0, 0, 0, 0, 0});
+        offsets.push_back({1, -0.05f, 0, 0, 0, 0, 0, 0});
+        effectors.emplace_back(0.08f, 0.0f, 0.0f);
+        targets.emplace_back(
+            0.3f * std::cos(20.0f * t), 10.0f * t + 0.2f * std::sin(7.0f * t), 0.25f);
+    }
+
+    std::vector<motor<>> rotations(rigs * joints, rest);
+    auto reset = [&] { std::fill(rotations.begin(), rotations.end(), rest); };
+
+    ik_result result;
+    std::printf(
+        "%zu rigs, %zu joints, at most %zu iterations\n", rigs, joints, settings.max_iterations);
+    std::printf("%-24s %12s %12s\n", "", "us/frame", "rigs/ms");
+    auto report = [&](char const* label, double us) {
+        std::printf("%-24s %12.1f %12.1f\n", label, us, rigs / us * 1000.0);
+    };
+
+    report("one rig at a time", time_us([&] {
+               reset();
+               for (size_t r = 0; r != rigs; ++r)
+               {
+                   solve_ik(joints,
+                            span{rotations}.subspan(r * joints, joints),
+                            span{offsets}.subspan(r * joints, joints),
+                            span{limits},
+                            span{effectors}.subspan(r, 1),
+                            span{targets}.subspan(r, 1),
+                            settings);
+               }
+           }));
+
+    report("batched", time_us([&] {
+               reset();
+               result = solve_ik(joints,
+                                 span{rotations},
+                                 span{offsets},
+                                 span{limits},
+                                 span{effectors},
+                                 span{targets},
+                                 settings);
+           }));
+    std::printf("%zu of %zu rigs converged\n", result.converged, rigs);
+
+    size_t const threads = std::max(1u, std::thread::hardware_concurrency());
+    thread_pool pool{threads - 1};
+    std::printf("parallel over %zu threads\n", threads);
+    report("batched", time_us([&] {
+               reset();
+               parallel_solve_ik(pool,
+                                 joints,
+                                 span{rotations},
+                                 span{offsets},
+                                 span{limits},
+                                 span{effectors},
+                                 span{targets},
+                                 settings);
+           }));
+
+    // Consume the output so the computation cannot be elided
+    return rotations[rigs / 2][0] == 12345.0f;
+}
@@ -0,0 +1,75 @@
+// Scaling benchmark for parallel_compute. Applies a distinct motor to each of a large number of
+// points stored in AoSoA blocks, once per thread count from 1 up to the hardware concurrency (or
+// the count passed as the first argument), and reports throughput and speedup relative to a single
+// thread.
+//
+// Usage: gal_parallel_bench [max threads] [element count]
+
+#include <gal/pga.hpp>
+#include <gal/thread_pool.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+using namespace gal;
+using namespace gal::pga;
+
+using pnt = point<float>;
+
+int main(int argc, char** argv)
+{
+    size_t const max_threads = argc > 1 ? std::strtoull(argv[1], nullptr, 10)
+                                        : std::max(1u, std::thread::hardware_concurrency());
+    size_t const count = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : (size_t{1} << 22);
+
+    std::vector<aosoa_block<pnt, 8>> point_blocks(aosoa_span<pnt, 8>::block_count(count));
+    std::vector<aosoa_block<motor<>, 8>> motor_blocks(point_blocks.size());
+    std::vector<aosoa_block<pnt, 8>> out_blocks(point_blocks.size());
+    aosoa_span<pnt, 8> points{point_blocks.data(), count};
+    aosoa_span<motor<>, 8> motors{motor_blocks.data(), count};
+    aosoa_span<pnt, 8> out{out_blocks.data(), count};
+    for (size_t i = 0; i != count; ++i)
+    {
+        float t   = static_cast<float>(i) / count;
+        points[i] = pnt{t, 1.0f - t, 2.0f * t, 1.0f};
+        motors[i] = motor<>{1.0f, 0.1f * t, 0.2f, -0.3f, 0.4f * t, 0.5f, -0.6f, 0.7f * t};
+    }
+
+    auto sandwich = [](auto p, auto m) { return m * p * ~m; };
+
+    std::printf("%zu elements\n", count);
+    std::printf("%8s %12s %12s %8s\n", "threads", "ms/iter", "Melem/s", "speedup");
+    double baseline = 0.0;
+    // Thread counts double up to (and always include) the maximum
+    for (size_t threads = 1; threads <= max_threads;
+         threads = threads != max_threads ? std::min(threads * 2, max_threads) : threads + 1)
+    {
+        thread_pool pool{threads - 1};
+
+        // Warm up (faults in the output pages and spins up the workers)
+        gal::pga::parallel_compute(pool, sandwich, out, points, motors);
+
+        constexpr int iterations = 10;
+        auto start               = std::chrono::steady_clock::now();
+        for (int i = 0; i != iterations; ++i)
+        {
+            gal::pga::parallel_compute(pool, sandwich, out, points, motors);
+        }
+        std::chrono::duration<double, std::milli> elapsed
+            = std::chrono::steady_clock::now() - start;
+
+        double ms = elapsed.count() / iterations;
+        if (threads == 1)
+        {
+            baseline = ms;
+        }
+        std::printf("%8zu %12.3f %12.1f %8.2f\n", threads, ms, count / ms / 1000.0, baseline / ms);
+    }
+
+    // Consume the output so the computation cannot be elided
+    return out[count / 2][0] == 12345.0f;
+}
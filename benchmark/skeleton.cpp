@@ -0,0 +1,129 @@
+// Forward kinematics benchmark. Evaluates the world motors (and optionally matrices) of a crowd of
+// identical rigs concatenated into one hierarchy, comparing gal::pga::skeleton against composing
+// one motor per joint in index order.
+//
+// Usage: gal_skeleton_bench [rig count] [max threads]
+
+#include <gal/skeleton.hpp>
+#include <gal/thread_pool.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+using namespace gal;
+using namespace gal::pga;
+
+template <typename F>
+double time_us(F&& f)
+{
+    // Warm up (faults in the output pages and spins up any workers)
+    f();
+
+    constexpr int iterations = 100;
+    auto start               = std::chrono::steady_clock::now();
+    for (int i = 0; i != iterations; ++i)
+    {
+        f();
+    }
+    std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count() / iterations;
+}
+
+int main(int argc, char** argv)
+{
+    size_t const rigs        = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 200;
+    size_t const max_threads = argc > 2 ? std::strtoull(argv[2], nullptr, 10)
+                                        : std::max(1u, std::thread::hardware_concurrency());
+
+    // A 50 joint humanoid: spine and head, two arms with five fingers each and two legs
+    std::vector<int32_t> rig{skeleton::root, 0, 1, 2, 3, 4};
+    auto chain = [&](int32_t parent, size_t length) {
+        for (size_t i = 0; i != length; ++i)
+        {
+            rig.push_back(parent);
+            parent = static_cast<int32_t>(rig.size() - 1);
+        }
+        return parent;
+    };
+    for (int side = 0; side != 2; ++side)
+    {
+        int32_t wrist = chain(3, 4);
+        for (int finger = 0; finger != 5; ++finger)
+        {
+            chain(wrist, 3);
+        }
+    }
+    chain(0, 3);
+    chain(0, 3);
+
+    std::vector<int32_t> parents;
+    for (size_t r = 0; r != rigs; ++r)
+    {
+        auto base = static_cast<int32_t>(parents.size());
+        for (int32_t parent : rig)
+        {
+            parents.push_back(parent == skeleton::root ? parent : base + parent);
+        }
+    }
+
+    std::vector<uint32_t> order(parents.size());
+    skeleton crowd{parents, order};
+
+    std::vector<motor<>> local;
+    for (size_t i = 0; i != parents.size(); ++i)
+    {
+        float t = static_cast<float>(i % rig.size()) / rig.size();
+        line<> l{0.3f * t, 0.2f, -0.4f * t, t, -1.0f, 0.5f * t};
+        local.push_back(gal::pga::compute([](auto l) { return exp(l); }, l));
+    }
+    motor<> root_motor{1, 0, 0, 0, 0, 0, 0, 0};
+    std::vector<motor<>> world(parents.size(), root_motor);
+    std::vector<matrix<float, 3, 4>> matrices(parents.size());
+
+    std::printf("%zu rigs, %zu joints, %zu levels\n", rigs, parents.size(), crowd.depth());
+    std::printf("%-32s %12s\n", "", "us/iter");
+    auto report = [](char const* label, double us) { std::printf("%-32s %12.1f\n", label, us); };
+
+    report("per-joint", time_us([&] {
+               for (size_t i = 0; i != parents.size(); ++i)
+               {
+                   motor<> const& parent
+                       = parents[i] == skeleton::root ? root_motor : world[parents[i]];
+                   world[i] = gal::pga::compute(
+                       [](auto p, auto l) { return p * l; }, parent, local[i]);
+               }
+           }));
+
+    report("per-joint + to_matrix", time_us([&] {
+               for (size_t i = 0; i != parents.size(); ++i)
+               {
+                   motor<> const& parent
+                       = parents[i] == skeleton::root ? root_motor : world[parents[i]];
+                   world[i] = gal::pga::compute(
+                       [](auto p, auto l) { return p * l; }, parent, local[i]);
+                   matrices[i] = to_matrix(world[i]);
+               }
+           }));
+
+    report("forward_kinematics", time_us([&] {
+               crowd.forward_kinematics(span{world}, span{local}, root_motor);
+           }));
+
+    report("forward_kinematics + matrices", time_us([&] {
+               crowd.forward_kinematics(span{world}, span{matrices}, span{local}, root_motor);
+           }));
+
+    thread_pool pool{max_threads - 1};
+    std::printf("parallel over %zu threads\n", max_threads);
+    report("forward_kinematics + matrices", time_us([&] {
+               crowd.parallel_forward_kinematics(
+                   pool, span{world}, span{matrices}, span{local}, root_motor);
+           }));
+
+    // Consume the output so the computation cannot be elided
+    return world[parents.size() / 2][0] == 12345.0f && matrices.back()[0] == 12345.0f;
+}
@@ -0,0 +1,131 @@
+// Motor skinning benchmark. Deforms the positions and normals of a mesh with four influences per
+// vertex, comparing gal::pga::skin against blending, normalizing and transforming each vertex in
+// turn (the motor is normalized explicitly and each sandwich is evaluated on its own). The fused
+// kernel is also timed over the available threads.
+//
+// Usage: gal_skinning_bench [vertex count] [joint count]
+
+#include <gal/skinning.hpp>
+#include <gal/thread_pool.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+using namespace gal;
+using namespace gal::pga;
+
+using pnt = gal::vga::point<float>;
+
+template <typename F>
+double time_ms(F&& f)
+{
+    // Warm up (faults in the output pages and spins up any workers)
+    f();
+
+    constexpr int iterations = 10;
+    auto start               = std::chrono::steady_clock::now();
+    for (int i = 0; i != iterations; ++i)
+    {
+        f();
+    }
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count() / iterations;
+}
+
+int main(int argc, char** argv)
+{
+    size_t const count       = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : size_t{1} << 20;
+    uint32_t const joint_num = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 64;
+
+    std::vector<motor<>> joints;
+    for (uint32_t i = 0; i != joint_num; ++i)
+    {
+        float t = static_cast<float>(i) / joint_num;
+        line<> l{0.3f * t, 0.2f, -0.4f * t, t, -1.0f, 0.5f * t};
+        joints.push_back(gal::pga::compute([](auto l) { return exp(l); }, l));
+    }
+
+    std::vector<skin_influences<>> influences(count);
+    std::vector<pnt> positions;
+    std::vector<vector<>> normals;
+    positions.reserve(count);
+    normals.reserve(count);
+    for (size_t i = 0; i != count; ++i)
+    {
+        float t           = static_cast<float>(i) / count;
+        auto j            = static_cast<uint32_t>(i % joint_num);
+        influences[i]     = {{j, (j + 1) % joint_num, (j + 2) % joint_num, (j + 7) % joint_num},
+                         {0.5f, 0.25f, 0.15f, 0.1f}};
+        positions.emplace_back(t, 1.0f - t, 2.0f * t);
+        normals.emplace_back(0.0f, 0.6f, 0.8f);
+    }
+
+    std::vector<pnt> out_positions(count, pnt{0, 0, 0});
+    std::vector<vector<>> out_normals(count, vector<>{0, 0, 0});
+
+    std::printf("%zu vertices, %u joints, 4 influences\n", count, joint_num);
+    std::printf("%-24s %12s %12s\n", "", "ms/iter", "Mvert/s");
+    auto report = [&](char const* label, double ms) {
+        std::printf("%-24s %12.3f %12.1f\n", label, ms, count / ms / 1000.0);
+    };
+
+    report("per-vertex", time_ms([&] {
+               for (size_t v = 0; v != count; ++v)
+               {
+                   std::array<float, 8> blend{};
+                   for (size_t k = 0; k != 4; ++k)
+                   {
+                       motor<> const& joint = joints[influences[v].joints[k]];
+                       for (size_t i = 0; i != 8; ++i)
+                       {
+                           blend[i] += influences[v].weights[k] * joint[i];
+                       }
+                   }
+                   motor<> m{blend[0],
+                             blend[1],
+                             blend[2],
+                             blend[3],
+                             blend[4],
+                             blend[5],
+                             blend[6],
+                             blend[7]};
+                   m.normalize();
+                   auto sandwich    = [](auto m, auto x) { return m * x * ~m; };
+                   out_positions[v] = gal::pga::compute(sandwich, m, positions[v]);
+                   out_normals[v]   = gal::pga::compute(sandwich, m, normals[v]);
+               }
+           }));
+
+    report("skin", time_ms([&] {
+               skin(span{out_positions},
+                    span{out_normals},
+                    span{joints},
+                    span{influences},
+                    span{positions},
+                    span{normals});
+           }));
+
+    report("skin (positions only)", time_ms([&] {
+               skin(span{out_positions}, span{joints}, span{influences}, span{positions});
+           }));
+
+    size_t const threads = std::max(1u, std::thread::hardware_concurrency());
+    thread_pool pool{threads - 1};
+    std::printf("parallel_skin over %zu threads\n", threads);
+    report("parallel_skin", time_ms([&] {
+               parallel_skin(pool,
+                             span{out_positions},
+                             span{out_normals},
+                             span{joints},
+                             span{influences},
+                             span{positions},
+                             span{normals});
+           }));
+
+    // Consume the output so the computation cannot be elided
+    return out_positions[count / 2][0] == 12345.0f && out_normals[count / 2][0] == 12345.0f;
+}
@@ -23,56 +23,60 @@ namespace detail
     constexpr inline T ind_constants[] = {M_PI, 2.71828182845904523536};
 } // namespace detail
 
-// Although the multivector space will ultimately be defined over a field, we decompose the
-// field into the product of scalars (essentially factoring out a free module). The free module
-// over the ring of integers has the nice property that we can condense computation by
-// performing arithmetic exactly at compile time. The free module we factor out is a bimodule
-// (i.e. there is no preference for left or right multiplication by the scalar). An
-// indeterminate encodes its degree in the monomial, as well as its identifier (if available).
-// NOTE: "Degree" here is meant in the sense of a polynomial/monomial degree (e.g. x^2 has
-// degree 2 and x*y^2*z has degree 3). We permit negative degrees to allow expressing linear
-// combinations of nth-roots as well. The order of an indeterminate is the positive integer n
-// such that g^k = 0 for all k >= n The dual unit in particular has order 2. An order of "0"
-// here, by convention, refers to an infinite order.
-struct ind
+inline namespace GAL_RATIONAL_ABI
 {
-    width_t id{~0u};
-    rat degree;
-};
+    // Although the multivector space will ultimately be defined over a field, we decompose the
+    // field into the product of scalars (essentially factoring out a free module). The free module
+    // over the ring of integers has the nice property that we can condense computation by
+    // performing arithmetic exactly at compile time. The free module we factor out is a bimodule
+    // (i.e. there is no preference for left or right multiplication by the scalar). An
+    // indeterminate encodes its degree in the monomial, as well as its identifier (if available).
+    // NOTE: "Degree" here is meant in the sense of a polynomial/monomial degree (e.g. x^2 has
+    // degree 2 and x*y^2*z has degree 3). We permit negative degrees to allow expressing linear
+    // combinations of nth-roots as well. The order of an indeterminate is the positive integer n
+    // such that g^k = 0 for all k >= n The dual unit in particular has order 2. An order of "0"
+    // here, by convention, refers to an infinite order.
+    struct ind
+    {
+        width_t id{~0u};
+        rat degree;
+    };
 
-// The indeterminates that make up a monomial are weakly ordered based on the source identifiers.
-// If all indeterminates are identified (ID != ~0ull), the ordering becomes a total order.
-[[nodiscard]] constexpr bool operator==(ind lhs, ind rhs) noexcept
-{
-    return lhs.id == rhs.id && lhs.degree == rhs.degree;
-}
+    // The indeterminates that make up a monomial are weakly ordered based on the source
+    // identifiers. If all indeterminates are identified (ID != ~0ull), the ordering becomes a total
+    // order.
+    [[nodiscard]] constexpr bool operator==(ind lhs, ind rhs) noexcept
+    {
+        return lhs.id == rhs.id && lhs.degree == rhs.degree;
+    }
 
-[[nodiscard]] constexpr bool operator!=(ind lhs, ind rhs) noexcept
-{
-    return lhs.id != rhs.id || lhs.degree != rhs.degree;
-}
+    [[nodiscard]] constexpr bool operator!=(ind lhs, ind rhs) noexcept
+    {
+        return lhs.id != rhs.id || lhs.degree != rhs.degree;
+    }
 
-[[nodiscard]] constexpr bool operator<(ind lhs, ind rhs) noexcept
-{
-    return lhs.id < rhs.id || (lhs.id == rhs.id && lhs.degree < rhs.degree);
-}
+    [[nodiscard]] constexpr bool operator<(ind lhs, ind rhs) noexcept
+    {
+        return lhs.id < rhs.id || (lhs.id == rhs.id && lhs.degree < rhs.degree);
+    }
 
-[[nodiscard]] constexpr ind operator^(ind lhs, int rhs) noexcept
-{
-    lhs.degree *= rat{rhs};
-    return lhs;
-}
+    [[nodiscard]] constexpr ind operator^(ind lhs, int rhs) noexcept
+    {
+        lhs.degree *= rat{rhs};
+        return lhs;
+    }
 
-// TRICK
-// The shorter type names are intentional for producing less verbose type signatures in
-// compile-errors and diagnostics.
-struct mon
-{
-    rat q;
-    rat degree; // Sum of all exponents of indeterminates
-    width_t count      = 0;
-    width_t ind_offset = 0;
-};
+    // TRICK
+    // The shorter type names are intentional for producing less verbose type signatures in
+    // compile-errors and diagnostics.
+    struct mon
+    {
+        rat q;
+        rat degree; // Sum of all exponents of indeterminates
+        width_t count      = 0;
+        width_t ind_offset = 0;
+    };
+} // namespace GAL_RATIONAL_ABI
 
 // Temporal structure useful for sorting monomials in place
 struct mon_view
@@ -446,509 +450,481 @@ enum class mv_op : uint32_t
     cos,
     tan,
     sqrt,
+    sign,
+    // Closed forms of exp and log (see closed_forms.hpp). The DFA emits the results of one closed
+    // form as adjacent temporaries of the same argument, led by exp_even and log_odd respectively.
+    exp_even,
+    exp_odd,
+    exp_dual,
+    log_odd,
+    log_dual,
 };
 
 // Multivector representation, intended to be a compile-time representation
-// A := Algebra
-// I := Indeterminate capacity
-// M := Monomial capacity
-// T := Term capacity
-// The mv struct supports nested iteration. For example:
-//
-//     for (auto&& t : mv)
-//     {
-//         // t is a term in mv
-//         for (auto&& m : t)
-//         {
-//             // m is a monomial in t
-//             for (auto&& i : m)
-//             {
-//                 // i is an indeterminate in m
-//             }
-//         }
-//     }
-// In the snippet above, dereferencing any of t, m, or g will result in the reference to the object
-// in question.
-template <typename A, width_t I, width_t M, width_t T>
-struct mv
+inline namespace GAL_RATIONAL_ABI
 {
-    using algebra_t = A;
-
-    [[nodiscard]] constexpr static width_t ind_capacity() noexcept
+    // A := Algebra
+    // I := Indeterminate capacity
+    // M := Monomial capacity
+    // T := Term capacity
+    // The mv struct supports nested iteration. For example:
+    //
+    //     for (auto&& t : mv)
+    //     {
+    //         // t is a term in mv
+    //         for (auto&& m : t)
+    //         {
+    //             // m is a monomial in t
+    //             for (auto&& i : m)
+    //             {
+    //                 // i is an indeterminate in m
+    //             }
+    //         }
+    //     }
+    // In the snippet above, dereferencing any of t, m, or g will result in the reference to the
+    // object in question.
+    template <typename A, width_t I, width_t M, width_t T>
+    struct mv
     {
-        return I;
-    }
+        using algebra_t = A;
 
-    [[nodiscard]] constexpr static width_t mon_capacity() noexcept
-    {
-        return M;
-    }
+        [[nodiscard]] constexpr static width_t ind_capacity() noexcept
+        {
+            return I;
+        }
 
-    [[nodiscard]] constexpr static width_t term_capacity() noexcept
-    {
-        return T;
-    }
+        [[nodiscard]] constexpr static width_t mon_capacity() noexcept
+        {
+            return M;
+        }
+
+        [[nodiscard]] constexpr static width_t term_capacity() noexcept
+        {
+            return T;
+        }
 
-    mv_size size;
-    std::array<ind, I> inds;
-    std::array<mon, M> mons;
-    std::array<term, T> terms;
-    mv_op o{mv_op::id};
+        mv_size size;
+        std::array<ind, I> inds;
+        std::array<mon, M> mons;
+        std::array<term, T> terms;
+        mv_op o{mv_op::id};
 
-    // For evaluation, it is often convenient to fully evaluate a multivector and refer to it later.
-    // This creates a contracted form referencing the appropriate elements of this multivector
-    // (which will presumably be evaluated first).
-    constexpr mv<A, T, T, T> create_ref(uint32_t id) const noexcept
-    {
-        mv<A, T, T, T> out{};
-        out.size = mv_size{T, T, T};
-        for (width_t i = 0; i != T; ++i)
+        // For evaluation, it is often convenient to fully evaluate a multivector and refer to it
+        // later. This creates a contracted form referencing the appropriate elements of this
+        // multivector (which will presumably be evaluated first).
+        constexpr mv<A, T, T, T> create_ref(uint32_t id) const noexcept
         {
-            out.inds[i]  = ind{id + i, one};
-            out.mons[i]  = mon{one, one, 1, i};
-            out.terms[i] = term{1, i, terms[i].element};
+            mv<A, T, T, T> out{};
+            out.size = mv_size{T, T, T};
+            for (width_t i = 0; i != T; ++i)
+            {
+                out.inds[i]  = ind{id + i, one};
+                out.mons[i]  = mon{one, one, 1, i};
+                out.terms[i] = term{1, i, terms[i].element};
+            }
+            return out;
         }
-        return out;
-    }
 
-    constexpr void scale(rat q) noexcept
-    {
-        for (size_t i = 0; i != size.mon; ++i)
+        constexpr void scale(rat q) noexcept
         {
-            mons[i].q = q * mons[i].q;
+            for (size_t i = 0; i != size.mon; ++i)
+            {
+                mons[i].q = q * mons[i].q;
+            }
         }
-    }
 
-    // The transcendental operations here are applied to the final reified value.
-    constexpr void sin(rat q) noexcept
-    {
-        o = mv_op::sin;
-        scale(q);
-    }
+        // The transcendental operations here are applied to the final reified value.
+        constexpr void sin(rat q) noexcept
+        {
+            o = mv_op::sin;
+            scale(q);
+        }
 
-    constexpr void cos(rat q) noexcept
-    {
-        o = mv_op::cos;
-        scale(q);
-    }
+        constexpr void cos(rat q) noexcept
+        {
+            o = mv_op::cos;
+            scale(q);
+        }
 
-    constexpr void tan(rat q) noexcept
-    {
-        o = mv_op::tan;
-        scale(q);
-    }
+        constexpr void tan(rat q) noexcept
+        {
+            o = mv_op::tan;
+            scale(q);
+        }
 
-    constexpr void sqrt(rat q) noexcept
-    {
-        o = mv_op::sqrt;
-        scale(q);
-        // TODO:
-        // Check if we can take the sqrt of the scalar multiplier
+        constexpr void sign(rat q) noexcept
+        {
+            o = mv_op::sign;
+            scale(q);
+        }
 
-        // WARNING: this function is only defined for a multivector with a single indeterminate
-        // value for a single term and monomial.
-        // inds[0].degree *= one_half;
-        // mons[0].degree *= one_half;
-    }
+        constexpr void sqrt(rat q) noexcept
+        {
+            o = mv_op::sqrt;
+            scale(q);
+            // TODO:
+            // Check if we can take the sqrt of the scalar multiplier
+
+            // WARNING: this function is only defined for a multivector with a single indeterminate
+            // value for a single term and monomial.
+            // inds[0].degree *= one_half;
+            // mons[0].degree *= one_half;
+        }
 
-    // Select a single component and emit it as a scalar
-    constexpr mv<A, I, M, 1> operator[](elem_t e) const noexcept
-    {
-        mv<A, I, M, 1> out{};
-        for (auto it = cbegin(); it != cend(); ++it)
+        // Select a single component and emit it as a scalar
+        constexpr mv<A, I, M, 1> operator[](elem_t e) const noexcept
         {
-            if (it->element == e)
+            mv<A, I, M, 1> out{};
+            for (auto it = cbegin(); it != cend(); ++it)
             {
-                out.push(it, one, 0);
-                out.size.term = 1;
-                return out;
+                if (it->element == e)
+                {
+                    out.push(it, one, 0);
+                    out.size.term = 1;
+                    return out;
+                }
             }
+            return out;
         }
-        return out;
-    }
 
-    constexpr auto select_grade(elem_t grade) const noexcept
-    {
-        mv<A, I, M, T> out{};
-        auto out_terms_it = out.terms.begin();
-        auto out_mons_it  = out.mons.begin();
-        auto out_inds_it  = out.inds.begin();
-
-        for (auto it = cbegin(); it != cend(); ++it)
+        constexpr auto select_grade(elem_t grade) const noexcept
         {
-            auto g = pop_count(it->element);
-            if (g > grade)
-            {
-                break;
-            }
-            else if (g < grade)
-            {
-                continue;
-            }
-            else
+            mv<A, I, M, T> out{};
+            auto out_terms_it = out.terms.begin();
+            auto out_mons_it  = out.mons.begin();
+            auto out_inds_it  = out.inds.begin();
+
+            for (auto it = cbegin(); it != cend(); ++it)
             {
-                *out_terms_it            = *it;
-                out_terms_it->mon_offset = out_mons_it - out.mons.begin();
-                ++out_terms_it;
-                for (auto mon_it = it.cbegin(); mon_it != it.cend(); ++mon_it)
+                auto g = pop_count(it->element);
+                if (g > grade)
                 {
-                    *out_mons_it            = *mon_it;
-                    out_mons_it->ind_offset = out_inds_it - out.inds.begin();
-                    ++out_mons_it;
-                    for (auto ind_it = mon_it.cbegin(); ind_it != mon_it.cend(); ++ind_it)
+                    break;
+                }
+                else if (g < grade)
+                {
+                    continue;
+                }
+                else
+                {
+                    *out_terms_it            = *it;
+                    out_terms_it->mon_offset = out_mons_it - out.mons.begin();
+                    ++out_terms_it;
+                    for (auto mon_it = it.cbegin(); mon_it != it.cend(); ++mon_it)
                     {
-                        *out_inds_it++ = *ind_it;
+                        *out_mons_it            = *mon_it;
+                        out_mons_it->ind_offset = out_inds_it - out.inds.begin();
+                        ++out_mons_it;
+                        for (auto ind_it = mon_it.cbegin(); ind_it != mon_it.cend(); ++ind_it)
+                        {
+                            *out_inds_it++ = *ind_it;
+                        }
                     }
                 }
             }
-        }
-
-        out.size.term = out_terms_it - out.terms.begin();
-        out.size.mon  = out_mons_it - out.mons.begin();
-        out.size.ind  = out_inds_it - out.inds.begin();
-        return out;
-    }
 
-    // Push a term onto this multivector with a scaling factor and change of element
-    constexpr void push(const_term_it it, rat scale, elem_t e) noexcept
-    {
-        auto out_mons_it = mons.begin() + size.mon;
+            out.size.term = out_terms_it - out.terms.begin();
+            out.size.mon  = out_mons_it - out.mons.begin();
+            out.size.ind  = out_inds_it - out.inds.begin();
+            return out;
+        }
 
-        for (auto mon_it = it.cbegin(); mon_it != it.cend(); ++mon_it)
+        // Push a term onto this multivector with a scaling factor and change of element
+        constexpr void push(const_term_it it, rat scale, elem_t e) noexcept
         {
-            auto out_inds_it = inds.begin() + size.ind;
-            for (auto ind_it = mon_it.cbegin(); ind_it != mon_it.cend(); ++ind_it)
+            auto out_mons_it = mons.begin() + size.mon;
+
+            for (auto mon_it = it.cbegin(); mon_it != it.cend(); ++mon_it)
             {
-                *out_inds_it++ = *ind_it;
+                auto out_inds_it = inds.begin() + size.ind;
+                for (auto ind_it = mon_it.cbegin(); ind_it != mon_it.cend(); ++ind_it)
+                {
+                    *out_inds_it++ = *ind_it;
+                }
+                *out_mons_it            = *mon_it;
+                out_mons_it->q          = out_mons_it->q * scale;
+                out_mons_it->ind_offset = size.ind;
+                ++out_mons_it;
+                size.ind = static_cast<width_t>(out_inds_it - inds.begin());
             }
-            *out_mons_it            = *mon_it;
-            out_mons_it->q          = out_mons_it->q * scale;
-            out_mons_it->ind_offset = size.ind;
-            ++out_mons_it;
-            size.ind = static_cast<width_t>(out_inds_it - inds.begin());
-        }
-
-        terms[size.term]            = *it;
-        terms[size.term].element    = e;
-        terms[size.term].mon_offset = size.mon;
-        size.mon                    = static_cast<width_t>(out_mons_it - mons.begin());
-        ++size.term;
-    }
 
-    template <width_t I2, width_t M2, width_t T2>
-    [[nodiscard]] constexpr auto resize() const noexcept
-    {
-        if constexpr (I == I2 && M == M2 && T == T2)
-        {
-            return *this;
+            terms[size.term]            = *it;
+            terms[size.term].element    = e;
+            terms[size.term].mon_offset = size.mon;
+            size.mon                    = static_cast<width_t>(out_mons_it - mons.begin());
+            ++size.term;
         }
-        else
+
+        template <width_t I2, width_t M2, width_t T2>
+        [[nodiscard]] constexpr auto resize() const noexcept
         {
-            mv<A, I2, M2, T2> out{};
-            out.size = size;
-            for (size_t i = 0; i != out.size.ind; ++i)
+            if constexpr (I == I2 && M == M2 && T == T2)
             {
-                out.inds[i] = inds[i];
+                return *this;
             }
-            for (size_t i = 0; i != out.size.mon; ++i)
+            else
             {
-                out.mons[i] = mons[i];
+                mv<A, I2, M2, T2> out{};
+                out.size = size;
+                for (size_t i = 0; i != out.size.ind; ++i)
+                {
+                    out.inds[i] = inds[i];
+                }
+                for (size_t i = 0; i != out.size.mon; ++i)
+                {
+                    out.mons[i] = mons[i];
+                }
+                for (size_t i = 0; i != out.size.term; ++i)
+                {
+                    out.terms[i] = terms[i];
+                }
+                return out;
             }
-            for (size_t i = 0; i != out.size.term; ++i)
+        }
+
+        // Reshape the multivector to be fully dense in the arrays to simplify compilation of the
+        // final reduction
+        template <width_t IndMax, width_t MonMax, width_t TermMax>
+        [[nodiscard]] constexpr auto regularize() const noexcept
+        {
+            dense_mv<IndMax, MonMax, TermMax> out;
+
+            for (width_t i = 0; i != size.term; ++i)
             {
-                out.terms[i] = terms[i];
+                auto const& term = terms[i];
+                auto& out_term   = out.data[i];
+                out_term.first   = term;
+
+                for (width_t j = term.mon_offset; j != term.mon_offset + term.count; ++j)
+                {
+                    auto const& mon = mons[j];
+                    auto& out_mon   = out_term.second[j - term.mon_offset];
+                    out_mon.first   = mon;
+
+                    for (width_t k = mon.ind_offset; k != mon.ind_offset + mon.count; ++k)
+                    {
+                        out_mon.second[k - mon.ind_offset] = inds[k];
+                    }
+                }
             }
+
             return out;
         }
-    }
 
-    // Reshape the multivector to be fully dense in the arrays to simplify compilation of the final
-    // reduction
-    template <width_t IndMax, width_t MonMax, width_t TermMax>
-    [[nodiscard]] constexpr auto regularize() const noexcept
-    {
-        dense_mv<IndMax, MonMax, TermMax> out;
-
-        for (width_t i = 0; i != size.term; ++i)
+        [[nodiscard]] constexpr mv_size extent() const noexcept
         {
-            auto const& term = terms[i];
-            auto& out_term   = out.data[i];
-            out_term.first   = term;
+            // Determine the maximum number of indeterminates across all monomials and the maximum
+            // number of monomials across all terms
 
-            for (width_t j = term.mon_offset; j != term.mon_offset + term.count; ++j)
+            width_t mon_count = 0;
+            width_t ind_count = 0;
+            for (auto term_it = cbegin(); term_it != cend(); ++term_it)
             {
-                auto const& mon = mons[j];
-                auto& out_mon   = out_term.second[j - term.mon_offset];
-                out_mon.first   = mon;
+                if (term_it->count > mon_count)
+                {
+                    mon_count = term_it->count;
+                }
 
-                for (width_t k = mon.ind_offset; k != mon.ind_offset + mon.count; ++k)
+                for (auto mon_it = term_it.cbegin(); mon_it != term_it.cend(); ++mon_it)
                 {
-                    out_mon.second[k - mon.ind_offset] = inds[k];
+                    if (mon_it->count > ind_count)
+                    {
+                        ind_count = mon_it->count;
+                    }
                 }
             }
+            return {ind_count, mon_count, size.term};
         }
 
-        return out;
-    }
+        [[nodiscard]] constexpr const_term_it cbegin() const noexcept
+        {
+            return {inds.data(), mons.data(), terms.data()};
+        }
+
+        [[nodiscard]] constexpr term_it begin() noexcept
+        {
+            return {inds.data(), mons.data(), terms.data()};
+        }
+
+        [[nodiscard]] constexpr const_term_it cend() const noexcept
+        {
+            return {inds.data(), mons.data(), terms.data() + size.term};
+        }
+
+        [[nodiscard]] constexpr term_it end() noexcept
+        {
+            return {inds.data(), mons.data(), terms.data() + size.term};
+        }
+    };
+} // namespace GAL_RATIONAL_ABI
 
-    [[nodiscard]] constexpr mv_size extent() const noexcept
+namespace detail
+{
+    // Graded lexicographic comparison of two monomials (negative if lhs orders first, zero if the
+    // monomials differ only in their rational scaling factors)
+    [[nodiscard]] constexpr int compare_mons(const_mon_it lhs, const_mon_it rhs) noexcept
     {
-        // Determine the maximum number of indeterminates across all monomials and the maximum
-        // number of monomials across all terms
+        if (lhs->degree != rhs->degree)
+        {
+            return lhs->degree < rhs->degree ? -1 : 1;
+        }
 
-        width_t mon_count = 0;
-        width_t ind_count = 0;
-        for (auto term_it = cbegin(); term_it != cend(); ++term_it)
+        auto lhs_ind_it  = lhs.cbegin();
+        auto lhs_ind_end = lhs.cend();
+        auto rhs_ind_it  = rhs.cbegin();
+        auto rhs_ind_end = rhs.cend();
+        for (; lhs_ind_it != lhs_ind_end && rhs_ind_it != rhs_ind_end; ++lhs_ind_it, ++rhs_ind_it)
         {
-            if (term_it->count > mon_count)
+            if (*lhs_ind_it != *rhs_ind_it)
             {
-                mon_count = term_it->count;
+                return *lhs_ind_it < *rhs_ind_it ? -1 : 1;
             }
+        }
 
-            for (auto mon_it = term_it.cbegin(); mon_it != term_it.cend(); ++mon_it)
-            {
-                if (mon_it->count > ind_count)
-                {
-                    ind_count = mon_it->count;
-                }
-            }
+        if (lhs_ind_it == lhs_ind_end)
+        {
+            return rhs_ind_it == rhs_ind_end ? 0 : -1;
         }
-        return {ind_count, mon_count, size.term};
+        return 1;
     }
 
-    [[nodiscard]] constexpr const_term_it cbegin() const noexcept
+    // Output of merge_sum, written to the arrays of a multivector of sufficient capacity
+    struct sum_writer
     {
-        return {inds.data(), mons.data(), terms.data()};
-    }
+        ind* inds;
+        mon* mons;
+        term* terms;
+        mv_size size{};
 
-    [[nodiscard]] constexpr term_it begin() noexcept
-    {
-        return {inds.data(), mons.data(), terms.data()};
-    }
+        [[nodiscard]] constexpr width_t mon_count() const noexcept
+        {
+            return size.mon;
+        }
 
-    [[nodiscard]] constexpr const_term_it cend() const noexcept
-    {
-        return {inds.data(), mons.data(), terms.data() + size.term};
-    }
+        constexpr void push_mon(const_mon_it it, rat q) noexcept
+        {
+            mon& m       = mons[size.mon++];
+            m            = *it;
+            m.q          = q;
+            m.ind_offset = size.ind;
+            for (auto ind_it = it.cbegin(); ind_it != it.cend(); ++ind_it)
+            {
+                inds[size.ind++] = *ind_it;
+            }
+        }
 
-    [[nodiscard]] constexpr term_it end() noexcept
-    {
-        return {inds.data(), mons.data(), terms.data() + size.term};
-    }
-};
+        constexpr void push_term(term const& t, width_t mon_offset) noexcept
+        {
+            terms[size.term++] = term{size.mon - mon_offset, mon_offset, t.element};
+        }
+    };
 
-namespace detail
-{
+    // Terms, monomials, and indeterminates are all kept sorted, so the collated sum of two
+    // multivectors is produced by a single linear merge at each of the three levels
     template <typename A, width_t I1, width_t M1, width_t T1, width_t I2, width_t M2, width_t T2>
-    constexpr auto sum(mv<A, I1, M1, T1> const& lhs, mv<A, I2, M2, T2> const& rhs) noexcept
+    constexpr void
+    merge_sum(mv<A, I1, M1, T1> const& lhs, mv<A, I2, M2, T2> const& rhs, sum_writer& sink) noexcept
     {
-        constexpr size_t ind_size  = I1 + I2;
-        constexpr size_t mon_size  = M1 + M2;
-        constexpr size_t term_size = T1 + T2;
-        mv<A, ind_size, mon_size, term_size> out{};
-
-        auto lhs_it      = lhs.cbegin();
-        auto rhs_it      = rhs.cbegin();
-        auto lhs_end     = lhs.cend();
-        auto rhs_end     = rhs.cend();
-        auto out_ind_it  = out.inds.begin();
-        auto out_mon_it  = out.mons.begin();
-        auto out_term_it = out.terms.begin();
+        auto lhs_it  = lhs.cbegin();
+        auto rhs_it  = rhs.cbegin();
+        auto lhs_end = lhs.cend();
+        auto rhs_end = rhs.cend();
 
-        while (true)
+        while (lhs_it != lhs_end || rhs_it != rhs_end)
         {
-            if (lhs_it == lhs_end && rhs_it == rhs_end)
+            width_t mon_offset = sink.mon_count();
+
+            if (rhs_it == rhs_end || (lhs_it != lhs_end && lhs_it->element < rhs_it->element))
             {
-                // Base case
-                out.size = mv_size{static_cast<width_t>(out_ind_it - out.inds.begin()),
-                                   static_cast<width_t>(out_mon_it - out.mons.begin()),
-                                   static_cast<width_t>(out_term_it - out.terms.begin())};
-                return out;
+                for (auto mon_it = lhs_it.cbegin(); mon_it != lhs_it.cend(); ++mon_it)
+                {
+                    sink.push_mon(mon_it, mon_it->q);
+                }
+                sink.push_term(*lhs_it++, mon_offset);
             }
-            else if (lhs_it == lhs_end || rhs_it == rhs_end)
+            else if (lhs_it == lhs_end || rhs_it->element < lhs_it->element)
             {
-                auto& it  = lhs_it == lhs_end ? rhs_it : lhs_it;
-                auto& end = lhs_it == lhs_end ? rhs_end : lhs_end;
-
-                for (; it != end; ++it)
+                for (auto mon_it = rhs_it.cbegin(); mon_it != rhs_it.cend(); ++mon_it)
                 {
-                    *out_term_it            = *it;
-                    out_term_it->mon_offset = out_mon_it - out.mons.begin();
-                    ++out_term_it;
-
-                    for (auto m_it = it.cbegin(); m_it != it.cend(); ++m_it)
-                    {
-                        *out_mon_it            = *m_it;
-                        out_mon_it->ind_offset = out_ind_it - out.inds.begin();
-                        ++out_mon_it;
-
-                        for (auto i_it = m_it.cbegin(); i_it != m_it.cend(); ++i_it)
-                        {
-                            *out_ind_it++ = *i_it;
-                        }
-                    }
+                    sink.push_mon(mon_it, mon_it->q);
                 }
-                out.size = mv_size{static_cast<width_t>(out_ind_it - out.inds.begin()),
-                                   static_cast<width_t>(out_mon_it - out.mons.begin()),
-                                   static_cast<width_t>(out_term_it - out.terms.begin())};
-                return out;
+                sink.push_term(*rhs_it++, mon_offset);
             }
-            else if (rhs_it->element == lhs_it->element)
+            else
             {
                 auto lhs_mon_it  = lhs_it.cbegin();
                 auto lhs_mon_end = lhs_it.cend();
                 auto rhs_mon_it  = rhs_it.cbegin();
                 auto rhs_mon_end = rhs_it.cend();
-                auto mon_cursor  = out_mon_it;
 
-                while (true) // Graded lexicographic comparison
+                while (lhs_mon_it != lhs_mon_end || rhs_mon_it != rhs_mon_end)
                 {
-                    if (lhs_mon_it == lhs_mon_end && rhs_mon_it == rhs_mon_end)
+                    int order = rhs_mon_it == rhs_mon_end
+                                    ? -1
+                                    : lhs_mon_it == lhs_mon_end ? 1
+                                                                : compare_mons(lhs_mon_it, rhs_mon_it);
+                    if (order < 0)
                     {
-                        break;
+                        sink.push_mon(lhs_mon_it, lhs_mon_it->q);
+                        ++lhs_mon_it;
                     }
-                    else if (lhs_mon_it == lhs_mon_end || rhs_mon_it == rhs_mon_end)
+                    else if (order > 0)
                     {
-                        auto& it  = lhs_mon_it == lhs_mon_end ? rhs_mon_it : lhs_mon_it;
-                        auto& end = lhs_mon_it == lhs_mon_end ? rhs_mon_end : lhs_mon_end;
-                        for (; it != end; ++it)
-                        {
-                            *out_mon_it            = *it;
-                            out_mon_it->ind_offset = out_ind_it - out.inds.begin();
-                            ++out_mon_it;
-                            for (auto i_it = it.cbegin(); i_it != it.cend(); ++i_it)
-                            {
-                                *out_ind_it++ = *i_it;
-                            }
-                        }
-                        break;
+                        sink.push_mon(rhs_mon_it, rhs_mon_it->q);
+                        ++rhs_mon_it;
                     }
                     else
                     {
-                        // The monomials need to be evaluated for equality
-                        if (lhs_mon_it->degree != rhs_mon_it->degree)
-                        {
-                            auto& it
-                                = lhs_mon_it->degree < rhs_mon_it->degree ? lhs_mon_it : rhs_mon_it;
-                            *out_mon_it            = *it;
-                            out_mon_it->ind_offset = out_ind_it - out.inds.begin();
-                            ++out_mon_it;
-                            for (auto i_it = it.cbegin(); i_it != it.cend(); ++i_it)
-                            {
-                                *out_ind_it++ = *i_it;
-                            }
-                            ++it;
-                        }
-                        else
+                        // Coincident monomials are added and dropped if they cancel
+                        rat q = lhs_mon_it->q + rhs_mon_it->q;
+                        if (!q.is_zero())
                         {
-                            // Monomial degrees match so a lexicographic comparison is needed
-                            auto lhs_ind_it  = lhs_mon_it.cbegin();
-                            auto lhs_ind_end = lhs_mon_it.cend();
-                            auto rhs_ind_it  = rhs_mon_it.cbegin();
-                            auto rhs_ind_end = rhs_mon_it.cend();
-                            while (true)
-                            {
-                                if (lhs_ind_it == lhs_ind_end && rhs_ind_it == rhs_ind_end)
-                                {
-                                    // Important! When adding, we adopt the lhs rational scaling
-                                    // factor so added terms from the rhs need to be divided by the
-                                    // rhs rational scaling factor.
-                                    auto q = lhs_mon_it->q + rhs_mon_it->q;
-
-                                    if (!q.is_zero())
-                                    {
-                                        // The monomials compare equal and do not cancel
-                                        *out_mon_it            = *lhs_mon_it;
-                                        out_mon_it->ind_offset = out_ind_it - out.inds.begin();
-                                        out_mon_it->q          = q;
-                                        ++out_mon_it;
-
-                                        for (auto i_it = lhs_mon_it.cbegin();
-                                             i_it != lhs_mon_it.cend();
-                                             ++i_it)
-                                        {
-                                            *out_ind_it++ = *i_it;
-                                        }
-                                    }
-                                    ++lhs_mon_it;
-                                    ++rhs_mon_it;
-                                    break;
-                                }
-                                else if (lhs_ind_it == lhs_ind_end || rhs_ind_it == rhs_ind_end)
-                                {
-                                    auto& it = lhs_ind_it == lhs_ind_end ? lhs_mon_it : rhs_mon_it;
-                                    *out_mon_it            = *it;
-                                    out_mon_it->ind_offset = out_ind_it - out.inds.begin();
-                                    ++out_mon_it;
-
-                                    for (auto i_it = it.cbegin(); i_it != it.cend(); ++i_it)
-                                    {
-                                        *out_ind_it++ = *i_it;
-                                    }
-                                    ++it;
-                                    break;
-                                }
-                                else
-                                {
-                                    auto const& lhs_ind = *lhs_ind_it;
-                                    auto const& rhs_ind = *rhs_ind_it;
-                                    if (lhs_ind == rhs_ind)
-                                    {
-                                        ++lhs_ind_it;
-                                        ++rhs_ind_it;
-                                    }
-                                    else
-                                    {
-                                        auto& it    = lhs_ind < rhs_ind ? lhs_mon_it : rhs_mon_it;
-                                        *out_mon_it = *it;
-                                        out_mon_it->ind_offset = out_ind_it - out.inds.begin();
-                                        ++out_mon_it;
-                                        for (auto i_it = it.cbegin(); i_it != it.cend(); ++i_it)
-                                        {
-                                            *out_ind_it++ = *i_it;
-                                        }
-                                        ++it;
-                                        break;
-                                    }
-                                }
-                            }
+                            sink.push_mon(lhs_mon_it, q);
                         }
+                        ++lhs_mon_it;
+                        ++rhs_mon_it;
                     }
-                } // Graded lexicographic comparison
+                }
 
-                width_t mon_count = static_cast<width_t>(out_mon_it - mon_cursor);
-                if (mon_count != 0)
+                if (sink.mon_count() != mon_offset)
                 {
-                    *out_term_it            = *lhs_it;
-                    out_term_it->mon_offset = mon_cursor - out.mons.begin();
-                    out_term_it->count      = mon_count;
-                    ++out_term_it;
+                    sink.push_term(*lhs_it, mon_offset);
                 }
                 ++lhs_it;
                 ++rhs_it;
             }
-            else
-            {
-                auto& it        = lhs_it->element < rhs_it->element ? lhs_it : rhs_it;
-                auto& end       = lhs_it->element < rhs_it->element ? lhs_end : rhs_end;
-                auto mon_cursor = out_mon_it;
+        }
+    }
 
-                for (auto mon_it = it.cbegin(); mon_it != it.cend(); ++mon_it)
-                {
-                    *out_mon_it            = *mon_it;
-                    out_mon_it->ind_offset = out_ind_it - out.inds.begin();
-                    ++out_mon_it;
-                    for (auto i_it = mon_it.cbegin(); i_it != mon_it.cend(); ++i_it)
-                    {
-                        *out_ind_it++ = *i_it;
-                    }
-                }
+    template <typename A, width_t I1, width_t M1, width_t T1, width_t I2, width_t M2, width_t T2>
+    constexpr auto sum(mv<A, I1, M1, T1> const& lhs, mv<A, I2, M2, T2> const& rhs) noexcept
+    {
+        mv<A, I1 + I2, M1 + M2, T1 + T2> out{};
+        sum_writer writer{out.inds.data(), out.mons.data(), out.terms.data()};
+        merge_sum(lhs, rhs, writer);
+        out.size = writer.size;
+        return out;
+    }
 
-                *out_term_it            = *it++;
-                out_term_it->mon_offset = static_cast<width_t>(mon_cursor - out.mons.begin());
-                ++out_term_it;
-            }
-        }
+    // Polyadic sum that merges each summand into a running total. The total alternates between two
+    // buffers of the combined capacity instead of materializing a wider partial sum per summand.
+    template <typename A, width_t... I, width_t... M, width_t... T>
+    constexpr auto sum_n(mv<A, I, M, T> const&... summands) noexcept
+    {
+        using out_t = mv<A, (I + ... + 0), (M + ... + 0), (T + ... + 0)>;
+        out_t totals[2]{};
+        width_t current = 0;
+
+        auto accumulate = [&](auto const& summand) {
+            out_t& next = totals[current ^ 1];
+            sum_writer writer{next.inds.data(), next.mons.data(), next.terms.data()};
+            merge_sum(totals[current], summand, writer);
+            next.size = writer.size;
+            current ^= 1;
+        };
+        (accumulate(summands), ...);
+
+        return totals[current];
     }
 
     template <typename A, width_t I, width_t M, width_t T>
@@ -1433,6 +1409,928 @@ namespace detail
             }
         }
     }
+
+    enum class hnode_kind : uint8_t
+    {
+        leaf,    // lhs indexes a monomial
+        sum,     // The sum of nodes lhs and rhs
+        product, // The indeterminate identified by lhs multiplied by node rhs
+    };
+
+    struct hnode
+    {
+        hnode_kind kind = hnode_kind::leaf;
+        width_t lhs     = 0;
+        width_t rhs     = 0;
+    };
+
+    // A multivector whose terms are each factored into an expression tree (multivariate Horner
+    // form) rooted at roots[i]. Factors extracted from a term are removed from the indeterminates
+    // of its leaf monomials, so the inds, mons and o members are interchangeable with those of an
+    // mv when reifying a monomial.
+    template <width_t I, width_t M, width_t N, width_t T>
+    struct horner
+    {
+        std::array<ind, I> inds;
+        std::array<mon, M> mons;
+        std::array<hnode, N> nodes;
+        std::array<width_t, T> roots;
+        mv_op o{mv_op::id};
+        width_t ind_count  = 0;
+        width_t mon_count  = 0;
+        width_t node_count = 0;
+    };
+
+    // Every product node divides at least two monomials by an indeterminate, so the number of
+    // product nodes is bounded by half the total (positive integral) degree.
+    template <typename A, width_t I, width_t M, width_t T>
+    [[nodiscard]] constexpr width_t horner_capacity(mv<A, I, M, T> const& in) noexcept
+    {
+        num_t degree = 0;
+        for (width_t i = 0; i != in.size.ind; ++i)
+        {
+            if (in.inds[i].degree.den == 1 && in.inds[i].degree.num > 0)
+            {
+                degree += in.inds[i].degree.num;
+            }
+        }
+        return 2 * in.size.mon + static_cast<width_t>(degree / 2);
+    }
+
+    // Each extracted factor costs a pass over the monomials it divides, so multivectors with more
+    // monomials times distinct indeterminates than this are summed as is rather than factored to
+    // bound compile-time evaluation
+    constexpr inline width_t factor_pair_limit = 131072;
+
+    // Bound on the indeterminates tallied over all passes of a single factor. Once exceeded, the
+    // monomials left in each range are summed as is.
+    constexpr inline width_t factor_work_limit = 32768;
+
+    template <width_t I, width_t M, width_t N, width_t T>
+    struct horner_builder
+    {
+        horner<I, M, N, T> out{};
+        // Working copies of the source monomials. Degrees are reduced as factors are extracted.
+        std::array<ind, I> inds{};
+        std::array<mon, M> mons{};
+        std::array<width_t, M> order{};
+        std::array<width_t, M> scratch{};
+        // Each indeterminate's id is mapped once to a dense index into ids so common_factor can
+        // tally by direct indexing. Counts are reset after each use rather than zeroed per call.
+        // An id may appear more than once within a monomial, so seen records the last monomial
+        // (offset by one) tallied against each id to count monomials rather than occurrences.
+        std::array<width_t, I> dense{};
+        std::array<width_t, I> ids{};
+        std::array<width_t, I> counts{};
+        std::array<width_t, I> seen{};
+        std::array<width_t, I> touched{};
+        width_t id_count = 0;
+        width_t work     = 0;
+        bool factorable  = true;
+
+        constexpr void index(width_t i) noexcept
+        {
+            width_t k = 0;
+            while (k != id_count && ids[k] != inds[i].id)
+            {
+                ++k;
+            }
+            if (k == id_count)
+            {
+                ids[id_count++] = inds[i].id;
+            }
+            dense[i] = k;
+        }
+
+        constexpr width_t push(hnode n) noexcept
+        {
+            out.nodes[out.node_count] = n;
+            return out.node_count++;
+        }
+
+        constexpr width_t leaf(width_t m) noexcept
+        {
+            mon const& src = mons[m];
+            mon& dst       = out.mons[out.mon_count];
+            dst            = mon{src.q, zero, 0, out.ind_count};
+            for (width_t i = src.ind_offset; i != src.ind_offset + src.count; ++i)
+            {
+                if (!inds[i].degree.is_zero())
+                {
+                    out.inds[out.ind_count++] = inds[i];
+                    dst.degree += inds[i].degree;
+                    ++dst.count;
+                }
+            }
+            return push(hnode{hnode_kind::leaf, out.mon_count++, 0});
+        }
+
+        // Returns the index of the indeterminate of monomial m with the supplied id if it can be
+        // factored out (i.e. has a positive integral degree)
+        [[nodiscard]] constexpr width_t find(width_t m, width_t id) const noexcept
+        {
+            for (width_t i = mons[m].ind_offset; i != mons[m].ind_offset + mons[m].count; ++i)
+            {
+                if (inds[i].id == id && inds[i].degree.den == 1 && inds[i].degree.num > 0)
+                {
+                    return i;
+                }
+            }
+            return ~0u;
+        }
+
+        // Selects the indeterminate shared by the most monomials in the range, preferring the
+        // lowest id among ties
+        [[nodiscard]] constexpr std::pair<width_t, width_t>
+        common_factor(width_t begin, width_t end) noexcept
+        {
+            width_t distinct = 0;
+
+            for (width_t i = begin; i != end; ++i)
+            {
+                mon const& m = mons[order[i]];
+                work += m.count + 1;
+                for (width_t j = m.ind_offset; j != m.ind_offset + m.count; ++j)
+                {
+                    if (inds[j].degree.den != 1 || inds[j].degree.num <= 0)
+                    {
+                        continue;
+                    }
+
+                    width_t k = dense[j];
+                    if (seen[k] == i + 1)
+                    {
+                        continue;
+                    }
+                    seen[k] = i + 1;
+                    if (counts[k]++ == 0)
+                    {
+                        touched[distinct++] = k;
+                    }
+                }
+            }
+
+            width_t best_id    = ~0u;
+            width_t best_count = 0;
+            for (width_t t = 0; t != distinct; ++t)
+            {
+                width_t k = touched[t];
+                if (counts[k] > best_count || (counts[k] == best_count && ids[k] < best_id))
+                {
+                    best_id    = ids[k];
+                    best_count = counts[k];
+                }
+                counts[k] = 0;
+                seen[k]   = 0;
+            }
+            return {best_id, best_count};
+        }
+
+        constexpr width_t factor(width_t begin, width_t end) noexcept
+        {
+            if (end - begin == 1)
+            {
+                return leaf(order[begin]);
+            }
+
+            auto [id, count] = factorable && work <= factor_work_limit
+                                   ? common_factor(begin, end)
+                                   : std::pair<width_t, width_t>{~0u, 0};
+            if (count < 2)
+            {
+                // Nothing is shared, so sum the monomials (a right fold as in cterm)
+                width_t rhs = leaf(order[end - 1]);
+                for (width_t i = end - 1; i != begin; --i)
+                {
+                    rhs = push(hnode{hnode_kind::sum, leaf(order[i - 1]), rhs});
+                }
+                return rhs;
+            }
+
+            // Stable partition of the monomials divisible by the factor to the front of the range
+            width_t mid  = begin;
+            width_t tail = begin + count;
+            for (width_t i = begin; i != end; ++i)
+            {
+                width_t index = find(order[i], id);
+                if (index == ~0u)
+                {
+                    scratch[tail++] = order[i];
+                }
+                else
+                {
+                    inds[index].degree.num -= 1;
+                    scratch[mid++] = order[i];
+                }
+            }
+            for (width_t i = begin; i != end; ++i)
+            {
+                order[i] = scratch[i];
+            }
+
+            width_t product = push(hnode{hnode_kind::product, id, factor(begin, mid)});
+            if (mid == end)
+            {
+                return product;
+            }
+            return push(hnode{hnode_kind::sum, product, factor(mid, end)});
+        }
+    };
+
+    // Greedily factors each term of a multivector by repeatedly extracting the indeterminate
+    // common to the most monomials. For example, abc + abd + ae becomes a(b(c + d) + e), which
+    // evaluates with two multiplications instead of five. Multivectors to which a
+    // transcendental operation applies are not factored, as the operation applies per monomial,
+    // and neither are multivectors exceeding factor_pair_limit.
+    template <width_t I, width_t M, width_t N, width_t T, typename A, width_t I2, width_t M2, width_t T2>
+    [[nodiscard]] constexpr auto factor(mv<A, I2, M2, T2> const& in) noexcept
+    {
+        horner_builder<I, M, N, T> builder{};
+        for (width_t i = 0; i != in.size.ind; ++i)
+        {
+            builder.inds[i] = in.inds[i];
+            builder.index(i);
+        }
+        for (width_t i = 0; i != in.size.mon; ++i)
+        {
+            builder.mons[i]  = in.mons[i];
+            builder.order[i] = i;
+        }
+        builder.out.o      = in.o;
+        builder.factorable
+            = in.o == mv_op::id && in.size.mon * builder.id_count <= factor_pair_limit;
+
+        for (width_t i = 0; i != in.size.term; ++i)
+        {
+            term const& t        = in.terms[i];
+            builder.out.roots[i] = builder.factor(t.mon_offset, t.mon_offset + t.count);
+        }
+        return builder.out;
+    }
+
+    // Mirrors the number of multiplications ::gal::pow performs for a positive integral exponent
+    [[nodiscard]] constexpr width_t pow_muls(num_t n) noexcept
+    {
+        switch (n)
+        {
+        case 1:
+            return 0;
+        case 2:
+            return 1;
+        case 3:
+        case 4:
+            return 2;
+        case 5:
+        case 6:
+        case 8:
+            return 3;
+        case 7:
+            return 4;
+        default:
+            width_t muls = 0;
+            for (; n > 1; n >>= 1)
+            {
+                muls += (n & 1) == 1 ? 2 : 1;
+            }
+            return muls;
+        }
+    }
+
+    // Fractional exponents are a single call to std::pow and negative exponents add a division
+    [[nodiscard]] constexpr width_t pow_cost(rat degree) noexcept
+    {
+        if (degree.den != 1)
+        {
+            return 1;
+        }
+        else if (degree.num < 0)
+        {
+            return 1 + pow_muls(-degree.num);
+        }
+        return degree.num == 0 ? 0 : pow_muls(degree.num);
+    }
+
+    // Estimates the number of multiplications (and divisions) needed to evaluate a factored
+    // multivector. Compilers evaluate identical subexpressions once, so each distinct power and
+    // each distinct trailing product of a leaf monomial (they are right folds) is counted once.
+    template <width_t I, width_t M, width_t N, width_t T>
+    [[nodiscard]] constexpr width_t horner_cost(horner<I, M, N, T> const& h) noexcept
+    {
+        constexpr width_t size = [] {
+            width_t s = 2;
+            while (s < 4 * (I + M))
+            {
+                s *= 2;
+            }
+            return s;
+        }();
+        std::array<uint64_t, size> seen{};
+        auto insert = [&seen](uint64_t key) {
+            key        = key == 0 ? 1 : key;
+            width_t slot = static_cast<width_t>(key ^ (key >> 29)) & (size - 1);
+            while (seen[slot] != 0 && seen[slot] != key)
+            {
+                slot = (slot + 1) & (size - 1);
+            }
+            bool inserted = seen[slot] == 0;
+            seen[slot]    = key;
+            return inserted;
+        };
+        auto mix = [](uint64_t hash, uint64_t value) {
+            hash ^= value + 0x9e3779b97f4a7c15ull + (hash << 6) + (hash >> 2);
+            return hash * 0xff51afd7ed558ccdull;
+        };
+
+        width_t cost = 0;
+        for (width_t i = 0; i != h.node_count; ++i)
+        {
+            hnode const& n = h.nodes[i];
+            if (n.kind == hnode_kind::product)
+            {
+                ++cost;
+            }
+            else if (n.kind == hnode_kind::leaf && h.mons[n.lhs].count > 0)
+            {
+                mon const& m  = h.mons[n.lhs];
+                uint64_t hash = 0;
+                for (width_t j = m.ind_offset + m.count; j != m.ind_offset; --j)
+                {
+                    ind const& x   = h.inds[j - 1];
+                    uint64_t power = mix(mix(x.id, static_cast<uint64_t>(x.degree.num)),
+                                         static_cast<uint64_t>(x.degree.den));
+                    if (insert(mix(1, power)))
+                    {
+                        cost += pow_cost(x.degree);
+                    }
+                    hash = mix(hash, power);
+                    if (j - 1 != m.ind_offset + m.count - 1 && insert(mix(2, hash)))
+                    {
+                        ++cost;
+                    }
+                }
+
+                if ((abs(m.q.den) > 1 || abs(m.q.num) > 1 || m.q.num == -1)
+                    && insert(mix(mix(mix(3, hash), static_cast<uint64_t>(m.q.num)),
+                                  static_cast<uint64_t>(m.q.den))))
+                {
+                    ++cost;
+                }
+            }
+        }
+        return cost;
+    }
+
+    // A product of two indeterminates evaluated once and shared by the monomials of a multivector
+    // (lhs == rhs for a square)
+    struct hoisted_product
+    {
+        width_t lhs = 0;
+        width_t rhs = 0;
+    };
+
+    // Upper bound on the number of products hoisted from a single multivector
+    constexpr inline width_t hoist_capacity = 32;
+
+    // Each hoisted product costs a pass over every pair of indeterminates in every monomial, so
+    // multivectors with more pairs than this are left as is to bound compile-time evaluation
+    constexpr inline width_t hoist_pair_limit = 4096;
+
+    // Bound on the pairs tallied and table slots cleared over all passes of a single hoist. Small
+    // multivectors hoist up to hoist_capacity products, while large ones stop after a few passes
+    // so that no multivector under hoist_pair_limit exceeds the compiler's constexpr budget.
+    constexpr inline width_t hoist_work_limit = 65536;
+
+    // A multivector in which products of indeterminates shared across its terms have been replaced
+    // by new indeterminates. Product i is identified by base + i and may itself refer to products
+    // preceding it.
+    template <typename M>
+    struct hoisted
+    {
+        M ie;
+        std::array<hoisted_product, hoist_capacity> products{};
+        width_t count = 0;
+    };
+
+    // The number of (unordered) pairs of indeterminates over all monomials
+    template <typename A, width_t I, width_t M, width_t T>
+    [[nodiscard]] constexpr width_t hoist_pairs(mv<A, I, M, T> const& in) noexcept
+    {
+        width_t pairs = 0;
+        for (width_t i = 0; i != in.size.mon; ++i)
+        {
+            pairs += in.mons[i].count * (in.mons[i].count + 1) / 2;
+        }
+        return pairs;
+    }
+
+    // The hash table used to tally candidate products is sized to at least twice the number of
+    // pairs (and is left minimal when the multivector exceeds hoist_pair_limit)
+    template <typename A, width_t I, width_t M, width_t T>
+    [[nodiscard]] constexpr width_t hoist_table_size(mv<A, I, M, T> const& in) noexcept
+    {
+        width_t pairs = hoist_pairs(in);
+        if (pairs > hoist_pair_limit)
+        {
+            return 2;
+        }
+        width_t size = 2;
+        while (size < 2 * pairs)
+        {
+            size *= 2;
+        }
+        return size;
+    }
+
+    // Only indeterminates of unit degree are paired (or squared at degree two), so rewriting a
+    // monomial never increases its number of indeterminates
+    [[nodiscard]] constexpr bool is_hoistable(ind const& x, num_t degree) noexcept
+    {
+        return x.id < ind_constant_start && x.degree.den == 1 && x.degree.num == degree;
+    }
+
+    template <width_t S>
+    struct hoist_table
+    {
+        struct entry
+        {
+            width_t lhs   = ~0u;
+            width_t rhs   = ~0u;
+            width_t terms = 0;
+            width_t last  = ~0u; // The last term tallied, so each term is counted once
+        };
+
+        std::array<entry, S> entries{};
+        entry best{};
+
+        constexpr void tally(width_t lhs, width_t rhs, width_t term) noexcept
+        {
+            width_t slot = (lhs * 0x9e3779b1u ^ rhs * 0x85ebca77u) & (S - 1);
+            while (entries[slot].terms != 0
+                   && (entries[slot].lhs != lhs || entries[slot].rhs != rhs))
+            {
+                slot = (slot + 1) & (S - 1);
+            }
+
+            entry& e = entries[slot];
+            if (e.last == term)
+            {
+                return;
+            }
+            e.lhs  = lhs;
+            e.rhs  = rhs;
+            e.last = term;
+            ++e.terms;
+            if (e.terms > best.terms
+                || (e.terms == best.terms
+                    && (lhs < best.lhs || (lhs == best.lhs && rhs < best.rhs))))
+            {
+                best = e;
+            }
+        }
+    };
+
+    // Replaces the product p (if present) in monomial m by the indeterminate identified by id
+    template <typename A, width_t I, width_t M, width_t T>
+    constexpr void hoist_product(mv<A, I, M, T>& ie, mon& m, hoisted_product p, width_t id) noexcept
+    {
+        width_t end = m.ind_offset + m.count;
+        width_t lhs = ~0u;
+        width_t rhs = ~0u;
+        for (width_t i = m.ind_offset; i != end; ++i)
+        {
+            if (ie.inds[i].id == p.lhs && is_hoistable(ie.inds[i], p.lhs == p.rhs ? 2 : 1))
+            {
+                lhs = i;
+            }
+            else if (ie.inds[i].id == p.rhs && is_hoistable(ie.inds[i], 1))
+            {
+                rhs = i;
+            }
+        }
+
+        if (lhs == ~0u || (p.lhs != p.rhs && rhs == ~0u))
+        {
+            return;
+        }
+
+        ie.inds[lhs] = ind{id, one};
+        m.degree = m.degree - one;
+        if (p.lhs != p.rhs)
+        {
+            // Close the gap left by the second factor
+            for (width_t i = rhs; i + 1 != end; ++i)
+            {
+                ie.inds[i] = ie.inds[i + 1];
+            }
+            ie.inds[end - 1] = ind{};
+            --m.count;
+        }
+    }
+
+    // Greedily hoists the product of indeterminates common to the most terms of a multivector until
+    // no product is shared by at least two terms. For example, the terms ab + c and abd share ab,
+    // which becomes a single multiplication p = ab reused as p + c and pd. Sharing within a term is
+    // left to factor, which runs on the hoisted multivector. The supplied base must exceed the id
+    // of every indeterminate present.
+    template <width_t S, typename A, width_t I, width_t M, width_t T>
+    [[nodiscard]] constexpr auto hoist(mv<A, I, M, T> const& in, width_t base) noexcept
+    {
+        hoisted<mv<A, I, M, T>> out{in};
+        if (hoist_pairs(in) > hoist_pair_limit)
+        {
+            return out;
+        }
+
+        width_t work = 0;
+        while (out.count != hoist_capacity)
+        {
+            work += hoist_pairs(out.ie) + S;
+            if (work > hoist_work_limit)
+            {
+                break;
+            }
+
+            hoist_table<S> table{};
+            for (width_t t = 0; t != out.ie.size.term; ++t)
+            {
+                term const& tm = out.ie.terms[t];
+                for (width_t i = tm.mon_offset; i != tm.mon_offset + tm.count; ++i)
+                {
+                    mon const& m = out.ie.mons[i];
+                    for (width_t j = m.ind_offset; j != m.ind_offset + m.count; ++j)
+                    {
+                        ind const& x = out.ie.inds[j];
+                        if (is_hoistable(x, 2))
+                        {
+                            table.tally(x.id, x.id, t);
+                        }
+                        else if (is_hoistable(x, 1))
+                        {
+                            for (width_t k = j + 1; k != m.ind_offset + m.count; ++k)
+                            {
+                                ind const& y = out.ie.inds[k];
+                                if (is_hoistable(y, 1))
+                                {
+                                    table.tally(x.id < y.id ? x.id : y.id,
+                                                x.id < y.id ? y.id : x.id,
+                                                t);
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+
+            if (table.best.terms < 2)
+            {
+                break;
+            }
+
+            hoisted_product p{table.best.lhs, table.best.rhs};
+            for (width_t i = 0; i != out.ie.size.mon; ++i)
+            {
+                hoist_product(out.ie, out.ie.mons[i], p, base + out.count);
+            }
+            out.products[out.count++] = p;
+        }
+        return out;
+    }
+
+    // An indeterminate known to equal a rational multiple of another, such as a component of the
+    // reversion of an input (which is evaluated as a temporary when it is a common subexpression)
+    struct ind_alias
+    {
+        width_t id;
+        width_t target;
+        rat q;
+    };
+
+    // Replaces every indeterminate of integral degree that has an alias by its target, so that
+    // monomials refer to the inputs directly. Substitution may merge or cancel monomials, in which
+    // case the input is returned unchanged if Keep is set and the number of terms would change
+    // (the terms of a temporary are referenced by position).
+    template <bool Keep, typename A, width_t I, width_t M, width_t T, size_t N>
+    [[nodiscard]] constexpr auto substitute_aliases(mv<A, I, M, T> const& in,
+                                                    std::array<ind_alias, N> const& aliases,
+                                                    width_t alias_count) noexcept
+    {
+        mv<A, I, M, T> temp = in;
+        bool substituted    = false;
+        for (width_t i = 0; i != temp.size.mon; ++i)
+        {
+            mon& m     = temp.mons[i];
+            ind* first = temp.inds.data() + m.ind_offset;
+            ind* last  = first + m.count;
+            for (ind* it = first; it != last; ++it)
+            {
+                if (it->degree.den != 1)
+                {
+                    continue;
+                }
+
+                for (width_t j = 0; j != alias_count; ++j)
+                {
+                    if (aliases[j].id == it->id)
+                    {
+                        rat factor = it->degree.num < 0 ? aliases[j].q.reciprocal() : aliases[j].q;
+                        for (num_t k = 0; k != abs(it->degree.num); ++k)
+                        {
+                            m.q = m.q * factor;
+                        }
+                        it->id      = aliases[j].target;
+                        substituted = true;
+                        break;
+                    }
+                }
+            }
+
+            // Restore the order of the indeterminates and merge coincident identifiers
+            sort(first, last);
+            ind* out = first;
+            for (ind* it = first; it != last; ++it)
+            {
+                if (out != first && (out - 1)->id == it->id)
+                {
+                    (out - 1)->degree = (out - 1)->degree + it->degree;
+                    if ((out - 1)->degree.is_zero())
+                    {
+                        --out;
+                    }
+                }
+                else
+                {
+                    *out++ = *it;
+                }
+            }
+            m.count = static_cast<width_t>(out - first);
+        }
+
+        if (!substituted)
+        {
+            return in;
+        }
+
+        std::array<mon_view, M> views;
+        for (width_t i = 0; i != temp.size.mon; ++i)
+        {
+            views[i] = mon_view{temp.mons[i], temp.inds.begin()};
+        }
+
+        mv<A, I, M, T> out{};
+        out.o = in.o;
+        collate(temp.terms.begin(),
+                temp.terms.begin() + temp.size.term,
+                views.begin(),
+                temp.inds.begin(),
+                out.terms.begin(),
+                out.mons.begin(),
+                out.inds.begin(),
+                out.size);
+        return Keep && out.size.term != in.size.term ? in : out;
+    }
+
+    // Side relations are polynomials in the indeterminates which vanish for every admissible input
+    // (for example, the scalar and pseudoscalar parts of m~m - 1 for a normalized motor m). Each
+    // term of a relations multivector holds one relation and its element carries no meaning.
+
+    // Upper bound on the rewriting passes applied with a single relation, as the rewritten
+    // monomials may remain divisible by the leading monomial of the relation
+    constexpr inline width_t relation_passes = 4;
+
+    // Returns true if the monomial d divides the monomial m. Only positive integral degrees are
+    // divided, so rewriting never introduces roots or reciprocals.
+    [[nodiscard]] constexpr bool
+    divides(mon const& d, ind const* d_inds, mon const& m, ind const* m_inds) noexcept
+    {
+        width_t j = 0;
+        for (width_t i = 0; i != d.count; ++i)
+        {
+            ind const& x = d_inds[d.ind_offset + i];
+            if (x.degree.den != 1 || x.degree.num <= 0)
+            {
+                return false;
+            }
+
+            while (j != m.count && m_inds[m.ind_offset + j].id < x.id)
+            {
+                ++j;
+            }
+            if (j == m.count)
+            {
+                return false;
+            }
+
+            ind const& y = m_inds[m.ind_offset + j];
+            if (y.id != x.id || y.degree.den != 1 || y.degree < x.degree)
+            {
+                return false;
+            }
+            ++j;
+        }
+        return true;
+    }
+
+    // Estimates the cost of evaluating a polynomial as its monomial count (additions and scaling)
+    // plus the integral degree of its indeterminates (multiplications)
+    template <typename A, width_t I, width_t M>
+    [[nodiscard]] constexpr width_t relation_cost(mv<A, I, M, 1> const& p) noexcept
+    {
+        width_t cost = p.size.mon;
+        for (width_t i = 0; i != p.size.ind; ++i)
+        {
+            rat degree = p.inds[i].degree;
+            cost += degree.den == 1 && degree.num > 0 ? static_cast<width_t>(degree.num) : 1;
+        }
+        return cost;
+    }
+
+    // Rewrites the monomials of the polynomial p divisible by the leading monomial l of a relation
+    // l + s_1 + ... + s_n = 0 as multiples of -(s_1 + ... + s_n) / l, repeating until no monomial
+    // remains divisible. Returns false (leaving p unspecified) if the result exceeds the capacity
+    // of p or rewriting does not terminate within relation_passes.
+    template <typename A, width_t I, width_t M, typename R>
+    [[nodiscard]] constexpr bool
+    reduce_poly(mv<A, I, M, 1>& p, R const& relations, width_t relation, width_t lead) noexcept
+    {
+        term const& rt    = relations.terms[relation];
+        mon const& l      = relations.mons[rt.mon_offset + lead];
+        ind const* r_inds = relations.inds.data();
+
+        for (width_t pass = 0; pass != relation_passes + 1; ++pass)
+        {
+            bool divisible = false;
+            for (width_t i = 0; i != p.size.mon && !divisible; ++i)
+            {
+                divisible = divides(l, r_inds, p.mons[i], p.inds.data());
+            }
+            if (!divisible)
+            {
+                return true;
+            }
+            else if (pass == relation_passes)
+            {
+                return false;
+            }
+
+            mv<A, I, M, 1> next{};
+            width_t ind_count = 0;
+            width_t mon_count = 0;
+            for (width_t i = 0; i != p.size.mon; ++i)
+            {
+                mon const& m    = p.mons[i];
+                ind const* m_it = p.inds.data() + m.ind_offset;
+                if (!divides(l, r_inds, m, p.inds.data()))
+                {
+                    if (mon_count == M || ind_count + m.count > I)
+                    {
+                        return false;
+                    }
+                    next.mons[mon_count++] = mon{m.q, m.degree, m.count, ind_count};
+                    for (width_t k = 0; k != m.count; ++k)
+                    {
+                        next.inds[ind_count++] = m_it[k];
+                    }
+                    continue;
+                }
+
+                for (width_t j = 0; j != rt.count; ++j)
+                {
+                    if (j == lead)
+                    {
+                        continue;
+                    }
+
+                    mon const& r    = relations.mons[rt.mon_offset + j];
+                    ind const* r_it = r_inds + r.ind_offset;
+                    ind const* l_it = r_inds + l.ind_offset;
+                    if (mon_count == M || ind_count + m.count + r.count > I)
+                    {
+                        return false;
+                    }
+
+                    // Merge the indeterminates of m / l and r, which are all sorted by identifier
+                    width_t offset = ind_count;
+                    rat degree     = zero;
+                    width_t a      = 0;
+                    width_t b      = 0;
+                    width_t c      = 0;
+                    while (a != m.count || b != r.count)
+                    {
+                        ind x;
+                        if (b == r.count || (a != m.count && m_it[a].id < r_it[b].id))
+                        {
+                            x = m_it[a++];
+                        }
+                        else if (a == m.count || r_it[b].id < m_it[a].id)
+                        {
+                            x = r_it[b++];
+                        }
+                        else
+                        {
+                            x        = m_it[a++];
+                            x.degree = x.degree + r_it[b++].degree;
+                        }
+
+                        if (c != l.count && l_it[c].id == x.id)
+                        {
+                            x.degree = x.degree - l_it[c++].degree;
+                        }
+
+                        if (!x.degree.is_zero())
+                        {
+                            next.inds[ind_count++] = x;
+                            degree                 = degree + x.degree;
+                        }
+                    }
+                    next.mons[mon_count++] = mon{-(m.q * r.q / l.q), degree, ind_count - offset, offset};
+                }
+            }
+
+            next.terms[0] = term{mon_count, 0, 0};
+            next.size     = mv_size{ind_count, mon_count, 1};
+
+            std::array<mon_view, M> views;
+            for (width_t i = 0; i != mon_count; ++i)
+            {
+                views[i] = mon_view{next.mons[i], next.inds.begin()};
+            }
+
+            p = mv<A, I, M, 1>{};
+            collate(next.terms.begin(),
+                    next.terms.begin() + 1,
+                    views.begin(),
+                    next.inds.begin(),
+                    p.terms.begin(),
+                    p.mons.begin(),
+                    p.inds.begin(),
+                    p.size);
+        }
+        return false;
+    }
+
+    // Rewrites each term of a multivector modulo a set of side relations wherever doing so lowers
+    // its estimated cost (see relation_cost). Every monomial of every relation is tried as the
+    // leading monomial until no rewrite improves the term. For example, the diagonal entry
+    // s^2 - a^2 - b^2 + c^2 of a rotation becomes 1 - 2a^2 - 2b^2 given s^2 + a^2 + b^2 + c^2 = 1.
+    // Terms that vanish are dropped unless Keep is set (the terms of a temporary are referenced by
+    // position), and terms whose rewritten form does not fit the capacity of the multivector are
+    // left as is. Multivectors to which a transcendental operation applies are not rewritten.
+    template <bool Keep, typename A, width_t I, width_t M, width_t T, typename R>
+    [[nodiscard]] constexpr auto reduce_relations(mv<A, I, M, T> const& in,
+                                                  R const& relations) noexcept
+    {
+        if (in.o != mv_op::id || relations.size.term == 0)
+        {
+            return in;
+        }
+
+        // Rewriting a term may expand it before it collapses
+        using poly_t = mv<A, 2 * I + R::ind_capacity(), 2 * M + R::mon_capacity(), 1>;
+
+        mv<A, I, M, T> out{};
+        out.o = in.o;
+        for (auto it = in.cbegin(); it != in.cend(); ++it)
+        {
+            poly_t original{};
+            original.push(it, one, 0);
+
+            poly_t best       = original;
+            width_t best_cost = relation_cost(best);
+            for (bool improved = true; improved;)
+            {
+                improved = false;
+                for (width_t r = 0; r != relations.size.term; ++r)
+                {
+                    for (width_t lead = 0; lead != relations.terms[r].count; ++lead)
+                    {
+                        poly_t candidate = best;
+                        if (reduce_poly(candidate, relations, r, lead)
+                            && relation_cost(candidate) < best_cost)
+                        {
+                            best      = candidate;
+                            best_cost = relation_cost(candidate);
+                            improved  = true;
+                        }
+                    }
+                }
+            }
+
+            if (best.size.term == 0)
+            {
+                if (!Keep)
+                {
+                    continue;
+                }
+                best = original;
+            }
+            else if (out.size.ind + best.size.ind > I || out.size.mon + best.size.mon > M)
+            {
+                best = original;
+            }
+            out.push(best.cbegin(), one, static_cast<elem_t>(it->element));
+        }
+        return out;
+    }
 } // namespace detail
 
 // Convenience template variable for making basis elements
@@ -42,162 +42,171 @@ namespace detail
         rhs   = tmp;
     }
 
-    // Needed for the time being because std::sort is not yet declared constexpr
-    template <typename T>
-    constexpr void sort(T first, T last) noexcept
+    // Ranges no longer than this are left to the final insertion sort pass
+    constexpr inline ptrdiff_t sort_threshold = 16;
+
+    template <typename T, typename L>
+    constexpr void insertion_sort(T first, T last, L& less) noexcept
     {
-        if (last - first < 2)
+        if (first == last)
         {
-            // Don't bother sorting an empty or single element range
             return;
         }
-        else if (last - first < 3)
+
+        for (auto it = first + 1; it != last; ++it)
         {
-            if (*(first + 1) < *first)
+            auto value = *it;
+            auto hole  = it;
+            while (hole != first && less(value, *(hole - 1)))
             {
-                swap(*first, *(first + 1));
+                *hole = *(hole - 1);
+                --hole;
             }
+            *hole = value;
         }
-        else if (last - first < 4)
+    }
+
+    template <typename T, typename L>
+    constexpr void sift_down(T first, ptrdiff_t root, ptrdiff_t count, L& less) noexcept
+    {
+        auto value = *(first + root);
+        while (true)
         {
-            // For a short 3 element run, do a few quick comparisons and swaps to terminate sooner
-            if (*(first + 1) < *first)
+            ptrdiff_t child = 2 * root + 1;
+            if (child >= count)
             {
-                if (*(first + 2) < *first)
-                {
-                    if (*(first + 2) < *(first + 1))
-                    {
-                        // 3 2 1
-                        swap(*first, *(first + 2));
-                    }
-                    else
-                    {
-                        // 3 1 2
-                        swap(*first, *(first + 1));
-                        swap(*(first + 1), *(first + 2));
-                    }
-                }
-                else
-                {
-                    // 2 1 3
-                    swap(*first, *(first + 1));
-                }
+                break;
             }
-            else
+            if (child + 1 < count && less(*(first + child), *(first + child + 1)))
             {
-                if (*(first + 2) < *first)
-                {
-                    // 2 3 1
-                    swap(*first, *(first + 1));
-                    swap(*first, *(first + 2));
-                }
-                else
-                {
-                    if (*(first + 2) < *(first + 1))
-                    {
-                        // 1 3 2
-                        swap(*(first + 1), *(first + 2));
-                    }
-                }
+                ++child;
             }
-        }
-        else
-        {
-            // NOTE: This is NOT the most efficient qsort implementation but it is implemented this
-            // way for simplicity. If it is a bottleneck, a faster sort will be implemented in the
-            // future. Use the last as the pivot
-            auto pivot  = *(last - 1);
-            auto cursor = first;
-            for (auto it = first; it != last - 1; ++it)
+            if (!less(value, *(first + child)))
             {
-                if (*it < pivot)
-                {
-                    swap(*cursor++, *it);
-                }
+                break;
             }
-            swap(*(last - 1), *cursor);
-            sort(first, cursor);
-            sort(cursor + 1, last);
+            *(first + root) = *(first + child);
+            root            = child;
         }
+        *(first + root) = value;
     }
 
-    // The third argument is a comparator
     template <typename T, typename L>
-    constexpr void sort(T first, T last, L&& less) noexcept
+    constexpr void heap_sort(T first, T last, L& less) noexcept
     {
-        if (last - first < 2)
+        ptrdiff_t count = last - first;
+        for (ptrdiff_t i = count / 2; i != 0; --i)
         {
-            // Don't bother sorting an empty or single element range
-            return;
+            sift_down(first, i - 1, count, less);
         }
-        else if (last - first < 3)
+        for (ptrdiff_t end = count - 1; end > 0; --end)
         {
-            if (less(*(first + 1), *first))
-            {
-                swap(*first, *(first + 1));
-            }
+            swap(*first, *(first + end));
+            sift_down(first, 0, end, less);
         }
-        else if (last - first < 4)
+    }
+
+    // Moves the median of a, b, and c to the front of the range to serve as the pivot
+    template <typename T, typename L>
+    constexpr void median_to_first(T first, T a, T b, T c, L& less) noexcept
+    {
+        if (less(*a, *b))
         {
-            // For a short 3 element run, do a few quick comparisons and swaps to terminate sooner
-            if (less(*(first + 1), *first))
+            if (less(*b, *c))
             {
-                if (less(*(first + 2), *first))
-                {
-                    if (less(*(first + 2), *(first + 1)))
-                    {
-                        // 3 2 1
-                        swap(*first, *(first + 2));
-                    }
-                    else
-                    {
-                        // 3 1 2
-                        swap(*first, *(first + 1));
-                        swap(*(first + 1), *(first + 2));
-                    }
-                }
-                else
-                {
-                    // 2 1 3
-                    swap(*first, *(first + 1));
-                }
+                swap(*first, *b);
+            }
+            else if (less(*a, *c))
+            {
+                swap(*first, *c);
             }
             else
             {
-                if (less(*(first + 2), *first))
-                {
-                    // 2 3 1
-                    swap(*first, *(first + 1));
-                    swap(*first, *(first + 2));
-                }
-                else
-                {
-                    if (less(*(first + 2), *(first + 1)))
-                    {
-                        // 1 3 2
-                        swap(*(first + 1), *(first + 2));
-                    }
-                }
+                swap(*first, *a);
             }
         }
+        else if (less(*a, *c))
+        {
+            swap(*first, *a);
+        }
+        else if (less(*b, *c))
+        {
+            swap(*first, *c);
+        }
         else
         {
-            // NOTE: This is NOT the most efficient qsort implementation but it is implemented this
-            // way for simplicity. If it is a bottleneck, a faster sort will be implemented in the
-            // future. Use the last as the pivot
-            auto pivot  = *(last - 1);
-            auto cursor = first;
-            for (auto it = first; it != last - 1; ++it)
+            swap(*first, *b);
+        }
+    }
+
+    // Partitions (first, last) about the pivot at first. The pivot and the median of three
+    // selection act as sentinels so neither scan needs a bounds check.
+    template <typename T, typename L>
+    constexpr T sort_partition(T first, T last, L& less) noexcept
+    {
+        T lo = first + 1;
+        T hi = last;
+        while (true)
+        {
+            while (less(*lo, *first))
+            {
+                ++lo;
+            }
+            --hi;
+            while (less(*first, *hi))
+            {
+                --hi;
+            }
+            if (!(lo < hi))
+            {
+                return lo;
+            }
+            swap(*lo, *hi);
+            ++lo;
+        }
+    }
+
+    template <typename T, typename L>
+    constexpr void introsort(T first, T last, ptrdiff_t depth, L& less) noexcept
+    {
+        while (last - first > sort_threshold)
+        {
+            if (depth == 0)
             {
-                if (less(*it, pivot))
-                {
-                    swap(*cursor++, *it);
-                }
+                // Partitioning has degenerated so fall back to a guaranteed O(n log n) sort
+                heap_sort(first, last, less);
+                return;
             }
-            swap(*(last - 1), *cursor);
-            sort(first, cursor, less);
-            sort(cursor + 1, last, less);
+            --depth;
+
+            median_to_first(first, first + 1, first + (last - first) / 2, last - 1, less);
+            T cut = sort_partition(first, last, less);
+            introsort(cut, last, depth, less);
+            last = cut;
         }
     }
+
+    // Needed for the time being because std::sort is not yet declared constexpr. This is an
+    // introsort: median of three quicksort, which handles the nearly sorted runs produced while
+    // collating terms and monomials well, bounded by a heapsort fallback and finished with a
+    // single insertion sort pass over the short partitions left behind.
+    // The third argument is a comparator
+    template <typename T, typename L>
+    constexpr void sort(T first, T last, L&& less) noexcept
+    {
+        ptrdiff_t depth = 0;
+        for (ptrdiff_t count = last - first; count > 1; count /= 2)
+        {
+            depth += 2;
+        }
+        introsort(first, last, depth, less);
+        insertion_sort(first, last, less);
+    }
+
+    template <typename T>
+    constexpr void sort(T first, T last) noexcept
+    {
+        sort(first, last, [](auto const& lhs, auto const& rhs) { return lhs < rhs; });
+    }
 } // namespace detail
 } // namespace gal
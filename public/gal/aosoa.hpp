@@ -0,0 +1,305 @@
+#pragma once
+
+#include "entity.hpp"
+#include "simd.hpp"
+#include "span.hpp"
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+
+// Structure-of-arrays (SoA) and array-of-structures-of-arrays (AoSoA) layouts for large
+// collections of entities. Storing N motors as N consecutive groups of 8 floats leaves every
+// component at an odd stride, so batched evaluation must transpose the data into SIMD lanes before
+// doing any work. The layouts below store components contiguously instead, so batched evaluation
+// loads lanes directly.
+//
+// As with all of GAL, nothing here allocates. The views are constructed over storage owned by the
+// caller (for example, a std::vector of aosoa_block).
+
+namespace gal
+{
+// W consecutive elements of an entity type E stored component-major: component i of the W elements
+// is a single simd<T, W> row. A block is itself a valid compute input (the lane type batched
+// evaluation operates on) and is aligned to the size of a row.
+template <typename E, size_t W>
+struct aosoa_block
+{
+    using algebra_t = typename E::algebra_t;
+    using value_t   = simd<typename E::value_t, W>;
+
+    std::array<value_t, E::size()> data_;
+
+    template <typename... Args>
+    GAL_NODISCARD constexpr static auto ie(Args... args) noexcept
+    {
+        return E::ie(args...);
+    }
+
+    // Side relations asserted by the element type hold for every lane (see normalized)
+    template <typename D = E>
+    GAL_NODISCARD constexpr static auto relations(uint32_t id) noexcept -> decltype(D::relations(id))
+    {
+        return D::relations(id);
+    }
+
+    GAL_NODISCARD constexpr static size_t size() noexcept
+    {
+        return E::size();
+    }
+
+    GAL_NODISCARD constexpr value_t const& operator[](size_t index) const noexcept
+    {
+        return data_[index];
+    }
+
+    GAL_NODISCARD constexpr value_t& operator[](size_t index) noexcept
+    {
+        return data_[index];
+    }
+};
+
+// Proxy to a single element of a SoA layout. Component i resides at base[i * stride]. The proxy
+// exposes the interface of the entity it refers to, so it may be passed to compute directly
+// and results may be assigned to it.
+template <typename E>
+struct soa_ref
+{
+    using algebra_t = typename E::algebra_t;
+    using value_t   = typename E::value_t;
+
+    value_t* base;
+    size_t stride;
+
+    template <typename... Args>
+    GAL_NODISCARD constexpr static auto ie(Args... args) noexcept
+    {
+        return E::ie(args...);
+    }
+
+    GAL_NODISCARD constexpr static size_t size() noexcept
+    {
+        return E::size();
+    }
+
+    GAL_NODISCARD constexpr value_t& operator[](size_t index) const noexcept
+    {
+        return base[index * stride];
+    }
+
+    // Stores an entity (converted to E if necessary)
+    template <typename R>
+    constexpr soa_ref& operator=(R const& in) noexcept
+    {
+        if constexpr (std::is_same_v<R, E>)
+        {
+            for (size_t i = 0; i != E::size(); ++i)
+            {
+                base[i * stride] = in[i];
+            }
+        }
+        else
+        {
+            E converted(in);
+            *this = converted;
+        }
+        return *this;
+    }
+};
+
+// Proxy to a single lane of an AoSoA block, with the interface of soa_ref. Components are reached
+// through the block's rows rather than by striding from the first row, as the rows are distinct
+// arrays.
+template <typename E, size_t W>
+struct aosoa_ref
+{
+    using algebra_t = typename E::algebra_t;
+    using value_t   = typename E::value_t;
+
+    aosoa_block<E, W>* block;
+    size_t lane;
+
+    template <typename... Args>
+    GAL_NODISCARD constexpr static auto ie(Args... args) noexcept
+    {
+        return E::ie(args...);
+    }
+
+    GAL_NODISCARD constexpr static size_t size() noexcept
+    {
+        return E::size();
+    }
+
+    GAL_NODISCARD constexpr value_t& operator[](size_t index) const noexcept
+    {
+        return block->data_[index][lane];
+    }
+
+    // Stores an entity (converted to E if necessary)
+    template <typename R>
+    constexpr aosoa_ref& operator=(R const& in) noexcept
+    {
+        if constexpr (std::is_same_v<R, E>)
+        {
+            for (size_t i = 0; i != E::size(); ++i)
+            {
+                block->data_[i][lane] = in[i];
+            }
+        }
+        else
+        {
+            E converted(in);
+            *this = converted;
+        }
+        return *this;
+    }
+};
+
+// Fully transposed view: component i of element j resides at data[i * stride + j]. The storage must
+// hold at least E::size() * stride values with stride >= size. Choosing a stride that is a multiple
+// of the SIMD width (padding each component row) keeps every row aligned.
+template <typename E>
+struct soa_span
+{
+    using element_t = E;
+    using value_t   = typename E::value_t;
+
+    value_t* data_ = nullptr;
+    size_t size_   = 0;
+    size_t stride_ = 0;
+
+    constexpr soa_span() noexcept = default;
+
+    constexpr soa_span(value_t* data, size_t size, size_t stride) noexcept
+        : data_{data}
+        , size_{size}
+        , stride_{stride}
+    {}
+
+    constexpr soa_span(value_t* data, size_t size) noexcept
+        : soa_span{data, size, size}
+    {}
+
+    // Number of values of storage required for count elements padded to a multiple of W lanes
+    GAL_NODISCARD constexpr static size_t storage_size(size_t count, size_t W = 1) noexcept
+    {
+        return E::size() * padded_stride(count, W);
+    }
+
+    GAL_NODISCARD constexpr static size_t padded_stride(size_t count, size_t W) noexcept
+    {
+        return (count + W - 1) / W * W;
+    }
+
+    GAL_NODISCARD constexpr size_t size() const noexcept
+    {
+        return size_;
+    }
+
+    GAL_NODISCARD constexpr size_t stride() const noexcept
+    {
+        return stride_;
+    }
+
+    GAL_NODISCARD constexpr value_t* row(size_t component) const noexcept
+    {
+        return data_ + component * stride_;
+    }
+
+    GAL_NODISCARD constexpr soa_ref<E> operator[](size_t index) const noexcept
+    {
+        return {data_ + index, stride_};
+    }
+
+    GAL_NODISCARD constexpr soa_span<E> subspan(size_t offset, size_t count) const noexcept
+    {
+        return {data_ + offset, count, stride_};
+    }
+};
+
+// View over contiguous AoSoA blocks holding size elements. The final block may be partially
+// occupied; its unused lanes are padding and are overwritten freely by batched evaluation.
+template <typename E, size_t W>
+struct aosoa_span
+{
+    using element_t = E;
+    using block_t   = aosoa_block<E, W>;
+    using value_t   = typename E::value_t;
+
+    block_t* blocks_ = nullptr;
+    size_t size_     = 0;
+
+    constexpr aosoa_span() noexcept = default;
+
+    constexpr aosoa_span(block_t* blocks, size_t size) noexcept
+        : blocks_{blocks}
+        , size_{size}
+    {}
+
+    // Views every lane of a contiguous container of blocks
+    template <typename C,
+              typename = std::enable_if_t<
+                  std::is_convertible_v<decltype(std::declval<C&>().data()), block_t*>>>
+    constexpr aosoa_span(C& blocks) noexcept
+        : blocks_{blocks.data()}
+        , size_{blocks.size() * W}
+    {}
+
+    GAL_NODISCARD constexpr static size_t width() noexcept
+    {
+        return W;
+    }
+
+    // Number of blocks required to store count elements
+    GAL_NODISCARD constexpr static size_t block_count(size_t count) noexcept
+    {
+        return (count + W - 1) / W;
+    }
+
+    GAL_NODISCARD constexpr size_t size() const noexcept
+    {
+        return size_;
+    }
+
+    GAL_NODISCARD constexpr block_t* blocks() const noexcept
+    {
+        return blocks_;
+    }
+
+    GAL_NODISCARD constexpr aosoa_ref<E, W> operator[](size_t index) const noexcept
+    {
+        return {blocks_ + index / W, index % W};
+    }
+
+    // The offset must be a multiple of W
+    GAL_NODISCARD constexpr aosoa_span<E, W> subspan(size_t offset, size_t count) const noexcept
+    {
+        return {blocks_ + offset / W, count};
+    }
+};
+
+namespace detail
+{
+    template <typename T>
+    struct is_soa_span : std::false_type
+    {};
+
+    template <typename E>
+    struct is_soa_span<soa_span<E>> : std::true_type
+    {};
+
+    template <typename T>
+    constexpr inline bool is_soa_span_v = is_soa_span<std::decay_t<T>>::value;
+
+    template <typename T>
+    struct aosoa_width : std::integral_constant<size_t, 0>
+    {};
+
+    template <typename E, size_t W>
+    struct aosoa_width<aosoa_span<E, W>> : std::integral_constant<size_t, W>
+    {};
+
+    template <typename T>
+    constexpr inline size_t aosoa_width_v = aosoa_width<std::decay_t<T>>::value;
+} // namespace detail
+} // namespace gal
@@ -184,6 +184,24 @@ namespace cga2
         return ::gal::detail::compute<::gal::cga2::cga2_algebra>(lambda, input...);
     }
 
+    template <typename... Free, typename L, typename... Bound>
+    auto bind(L lambda, Bound const&... bound)
+    {
+        return ::gal::detail::bind<::gal::cga2::cga2_algebra, Free...>(lambda, bound...);
+    }
+
+    template <typename L, typename O, typename... Data>
+    void compute_batch(L lambda, O const& out, Data const&... input)
+    {
+        ::gal::detail::compute_batch<::gal::cga2::cga2_algebra>(lambda, out, input...);
+    }
+
+    template <typename X, typename L, typename O, typename... Data>
+    void parallel_compute(X& executor, L lambda, O const& out, Data const&... input)
+    {
+        ::gal::detail::parallel_compute<::gal::cga2::cga2_algebra>(executor, lambda, out, input...);
+    }
+
     template <typename... Data>
     using evaluate = ::gal::detail::evaluate<gal::cga2::cga2_algebra, Data...>;
 } // namespace cga2
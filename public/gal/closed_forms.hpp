@@ -0,0 +1,155 @@
+#pragma once
+
+// closed_forms.hpp
+// The closed forms evaluated by exp and log (see op_exp and op_log in expr.hpp). This header
+// depends on no other GAL header besides opt.hpp so that it may also be included by the sources
+// written by codegen.hpp.
+
+#include <cmath>
+#include <type_traits>
+
+#include "opt.hpp"
+
+namespace gal
+{
+// sincos yields the sine and cosine of a shared argument from a single math library call where one
+// exists (glibc and other GNU-compatible libraries export sincos, Apple's and Microsoft's do not),
+// otherwise from separate calls.
+template <typename T, typename = std::enable_if_t<std::is_floating_point_v<T>>>
+GAL_FORCE_INLINE void sincos(T x, T& s, T& c) noexcept
+{
+#if (defined(__GNUC__) || defined(__clang__)) && !defined(__APPLE__)
+    if constexpr (std::is_same_v<T, float>)
+    {
+        __builtin_sincosf(x, &s, &c);
+    }
+    else if constexpr (std::is_same_v<T, double>)
+    {
+        __builtin_sincos(x, &s, &c);
+    }
+    else
+    {
+        __builtin_sincosl(x, &s, &c);
+    }
+#else
+    s = std::sin(x);
+    c = std::cos(x);
+#endif
+}
+
+// Each closed form is finite over the arguments that arise, including the limits reached by pure
+// translations.
+//
+// closed_dual computes (even - odd) / x as needed by exp_closed. The difference cancels
+// catastrophically for small x, where the Taylor series is used instead (its coefficients are
+// (-1)^k 2k / (2k + 1)! for k = 1..9, after which the terms fall below double precision for
+// |x| < 1).
+template <typename T>
+[[nodiscard]] GAL_FORCE_INLINE T closed_dual(T x, T even, T odd) noexcept
+{
+    constexpr double coefficients[] = {-1.0 / 3.0,
+                                       1.0 / 30.0,
+                                       -1.0 / 840.0,
+                                       1.0 / 45360.0,
+                                       -1.0 / 3991680.0,
+                                       1.0 / 518918400.0,
+                                       -1.0 / 93405312000.0,
+                                       1.0 / 22230464256000.0,
+                                       -1.0 / 6758061133824000.0};
+    T series{static_cast<T>(coefficients[8])};
+    for (int k = 8; k != 0; --k)
+    {
+        series = static_cast<T>(coefficients[k - 1]) + x * series;
+    }
+
+    bool const small = std::abs(x) < T{1};
+    T direct         = (even - odd) / (small ? T{1} : x);
+    return small ? series : direct;
+}
+
+// For x = a^2, exp_closed yields cos(a), sin(a) / a and (cos(a) - sin(a) / a) / x, or their
+// hyperbolic counterparts for x = -a^2 < 0. All three tend to 1, 1 and -1/3 as x tends to zero.
+// sinh and cosh are computed from e = expm1(a), which keeps sinh accurate for small a:
+// sinh(a) = e (1 + 1 / (e + 1)) / 2 and cosh(a) = (e + 1) / 2 + 1 / (2 (e + 1)).
+template <typename T, typename = std::enable_if_t<std::is_floating_point_v<T>>>
+GAL_FORCE_INLINE void exp_closed(T x, T& even, T& odd, T& dual) noexcept
+{
+    T a = std::sqrt(std::abs(x));
+    if (x > T{0})
+    {
+        T s;
+        sincos(a, s, even);
+        odd = s / a;
+    }
+    else
+    {
+        T e  = std::expm1(a);
+        T r  = T{1} / (e + T{1});
+        even = (e + T{1} + r) / T{2};
+        odd  = a == T{0} ? T{1} : e * (T{1} + r) / (T{2} * a);
+    }
+    dual = closed_dual(x, even, odd);
+}
+
+// For x = cos(t) with t in [0, pi), log_closed yields t / sin(t) and
+// (sin(t) - t cos(t)) / sin(t)^3, or their hyperbolic counterparts for x = cosh(t) > 1. Both tend
+// to 1 and 1/3 as x tends to one and diverge as x tends to -1. The angle and its sine are
+// recovered from the distance y to one, which is exact near one where acos would lose precision:
+// sin(t) = sqrt(|1 - x^2|) and t = 2 asin(sqrt(y / 2)) below one, and
+// t = log(cosh(t) + sinh(t)) = log1p(y + sinh(t)) above it. The dual term is that of exp at t^2
+// scaled by -(t / sin(t))^3.
+template <typename T, typename = std::enable_if_t<std::is_floating_point_v<T>>>
+GAL_FORCE_INLINE void log_closed(T x, T& odd, T& dual) noexcept
+{
+    bool const circular = x < T{1};
+    T y                  = std::abs(x - T{1});
+    T s2                 = y * (x + T{1});
+    T s                  = std::sqrt(s2 > T{0} ? s2 : T{0});
+    T t = circular ? T{2} * std::asin(std::sqrt(y / T{2})) : std::log1p(y + s);
+
+    odd  = y == T{0} ? T{1} : t / s;
+    dual = -closed_dual(circular ? t * t : -t * t, x, T{1} / odd) * odd * odd * odd;
+}
+
+// Branch-free variants of exp_closed and log_closed for value types evaluated lane by lane (see
+// simd.hpp). Where the form differs between arguments (circular or hyperbolic), both alternatives
+// are evaluated at an argument for which they are finite and the result is selected. This costs a
+// second transcendental call per lane but leaves no control flow for the lanes to diverge on.
+template <typename T, typename = std::enable_if_t<std::is_floating_point_v<T>>>
+GAL_FORCE_INLINE void exp_closed_branch_free(T x, T& even, T& odd, T& dual) noexcept
+{
+    bool const circular = x > T{0};
+    T a                 = std::sqrt(std::abs(x));
+
+    T s;
+    T c;
+    sincos(circular ? a : T{0}, s, c);
+
+    T e  = std::expm1(circular ? T{0} : a);
+    T r  = T{1} / (e + T{1});
+    T sh = e * (T{1} + r) / T{2};
+    T ch = (e + T{1} + r) / T{2};
+
+    bool const zero = a == T{0};
+    even            = circular ? c : ch;
+    odd             = zero ? T{1} : (circular ? s : sh) / (zero ? T{1} : a);
+    dual            = closed_dual(x, even, odd);
+}
+
+template <typename T, typename = std::enable_if_t<std::is_floating_point_v<T>>>
+GAL_FORCE_INLINE void log_closed_branch_free(T x, T& odd, T& dual) noexcept
+{
+    bool const circular = x < T{1};
+    T y                 = std::abs(x - T{1});
+    T s2                = y * (x + T{1});
+    T s                 = std::sqrt(s2 > T{0} ? s2 : T{0});
+    T h                 = std::sqrt(y / T{2});
+    T angle             = T{2} * std::asin(circular ? h : T{0});
+    T hyperbolic        = std::log1p(y + s);
+    T t                 = circular ? angle : hyperbolic;
+
+    bool const zero = y == T{0};
+    odd             = zero ? T{1} : t / (zero ? T{1} : s);
+    dual = -closed_dual(circular ? t * t : -t * t, x, T{1} / odd) * odd * odd * odd;
+}
+} // namespace gal
@@ -0,0 +1,476 @@
+#pragma once
+
+// codegen.hpp
+// Offline generation of plain C++ kernels from GAL lambdas. A kernel is reduced by the same
+// pipeline as compute (rpn_reshape, rpn_ctx and the temporaries evaluated by finalize_temps), but
+// instead of being reified by template instantiation in every translation unit that needs it, the
+// reduced multivectors are printed as a straight-line function over flat arrays. The printed
+// expressions mirror cmon, cterm and compute_entity operation for operation (including the
+// hoisted products, the factored form of each term and the order in which products are folded)
+// so that the generated code reproduces compute.
+//
+// Kernels are collected by a registry and written to a header/source pair that depends on nothing
+// but <cmath> and, for paired sines and cosines and the exponential and logarithm of a
+// multivector, the standalone gal/closed_forms.hpp (and only when a transcendental is used). See
+// the gal_add_kernels CMake function.
+
+#include "engine.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <type_traits>
+
+namespace gal
+{
+namespace codegen
+{
+    namespace detail
+    {
+        using ::gal::detail::abs;
+        using ::gal::detail::hnode;
+        using ::gal::detail::hnode_kind;
+        using ::gal::detail::ind_constant_start;
+        using ::gal::detail::ind_constants;
+
+        template <typename F>
+        constexpr inline char const* type_name = std::is_same_v<F, float> ? "float" : "double";
+
+        // Values are printed as hexadecimal floating point literals so they are reproduced exactly
+        template <typename F>
+        [[nodiscard]] inline std::string literal(F value)
+        {
+            char buffer[64];
+            std::snprintf(buffer,
+                          sizeof(buffer),
+                          value < 0 ? "(%a%s)" : "%a%s",
+                          static_cast<double>(value),
+                          std::is_same_v<F, float> ? "f" : "");
+            return buffer;
+        }
+
+        template <typename F>
+        struct printer
+        {
+            width_t input_size;
+            // Hoisted products occupy the data slots from hoist_base onwards (see reified in
+            // engine.hpp). As the slots are reused by every multivector, each product is printed
+            // with a distinct name offset by the number of products printed before it.
+            width_t hoist_base;
+            width_t hoist_offset   = 0;
+            bool uses_cmath        = false;
+            bool uses_closed_forms = false;
+
+            [[nodiscard]] std::string value(width_t id) const
+            {
+                if (id >= ind_constant_start)
+                {
+                    return literal<F>(ind_constants<F>[id - ind_constant_start]);
+                }
+                else if (id < input_size)
+                {
+                    return "in[" + std::to_string(id) + ']';
+                }
+                else if (id >= hoist_base)
+                {
+                    return 'p' + std::to_string(hoist_offset + id - hoist_base);
+                }
+                return 't' + std::to_string(id);
+            }
+
+            // Mirrors ::gal::pow
+            [[nodiscard]] std::string pow(std::string const& s, rat degree)
+            {
+                int n = static_cast<int>(degree.num);
+                int d = static_cast<int>(degree.den);
+                if (d > 1)
+                {
+                    uses_cmath = true;
+                    F exponent = F{static_cast<F>(n)} / F{static_cast<F>(d)};
+                    return "std::pow(" + s + ", " + literal(exponent) + ')';
+                }
+                else if (n == 1)
+                {
+                    return s;
+                }
+                else if (n < 0)
+                {
+                    return '(' + literal(F{1}) + " / " + pow(s, degree.negation()) + ')';
+                }
+
+                std::string s2 = '(' + s + " * " + s + ')';
+                std::string s4 = '(' + s2 + " * " + s2 + ')';
+                switch (n)
+                {
+                case 2:
+                    return s2;
+                case 3:
+                    return '(' + s + " * " + s + " * " + s + ')';
+                case 4:
+                    return s4;
+                case 5:
+                    return '(' + s2 + " * " + s2 + " * " + s + ')';
+                case 6: {
+                    std::string s3 = '(' + s2 + " * " + s + ')';
+                    return '(' + s3 + " * " + s3 + ')';
+                }
+                case 7:
+                    return '(' + s4 + " * " + s2 + " * " + s + ')';
+                case 8:
+                    return '(' + s4 + " * " + s4 + ')';
+                default: {
+                    // Right-to-left binary exponentiation. The leading multiplication by one is
+                    // exact and omitted.
+                    std::string temp1;
+                    std::string temp2 = s;
+                    for (; n > 1; n >>= 1)
+                    {
+                        if ((n & 1) == 1)
+                        {
+                            temp1 = temp1.empty() ? temp2 : '(' + temp1 + " * " + temp2 + ')';
+                        }
+                        temp2 = '(' + temp2 + " * " + temp2 + ')';
+                    }
+                    return temp1.empty() ? temp2 : '(' + temp1 + " * " + temp2 + ')';
+                }
+                }
+            }
+
+            [[nodiscard]] std::string apply(mv_op o, std::string const& in)
+            {
+                switch (o)
+                {
+                case mv_op::sin:
+                    uses_cmath = true;
+                    return "std::sin(" + in + ')';
+                case mv_op::cos:
+                    uses_cmath = true;
+                    return "std::cos(" + in + ')';
+                case mv_op::tan:
+                    uses_cmath = true;
+                    return "std::tan(" + in + ')';
+                case mv_op::sqrt:
+                    uses_cmath = true;
+                    return "std::sqrt(" + in + ')';
+                case mv_op::sign:
+                    uses_cmath = true;
+                    return "std::copysign(" + literal(F{1}) + ", " + in + ')';
+                default:
+                    return in;
+                }
+            }
+
+            // Mirrors cmon::value
+            template <typename M>
+            [[nodiscard]] std::string monomial(M const& ie, mon const& m)
+            {
+                if (m.q.is_zero())
+                {
+                    return literal(F{0});
+                }
+                else if (m.count == 0)
+                {
+                    return apply(ie.o, literal(static_cast<F>(m.q)));
+                }
+
+                // The product of indeterminates is a right fold
+                std::string product;
+                for (width_t i = m.count; i != 0; --i)
+                {
+                    ind const& x       = ie.inds[m.ind_offset + i - 1];
+                    std::string factor = pow(value(x.id), x.degree);
+                    product = product.empty() ? factor : '(' + factor + " * " + product + ')';
+                }
+
+                if (abs(m.q.den) > 1)
+                {
+                    if (abs(m.q.num) > 1 || m.q.num == -1)
+                    {
+                        return apply(ie.o, literal(static_cast<F>(m.q)) + " * " + product);
+                    }
+                    return apply(ie.o, product + " / " + literal(static_cast<F>(m.q.den)));
+                }
+                else if (abs(m.q.num) > 1 || m.q.num == -1)
+                {
+                    return apply(ie.o, literal(static_cast<F>(m.q.num)) + " * " + product);
+                }
+                return apply(ie.o, product);
+            }
+
+            // Mirrors cterm::value (a factored term, see horner in algebra.hpp)
+            template <typename H>
+            [[nodiscard]] std::string node(H const& h, width_t index)
+            {
+                hnode const& n = h.nodes[index];
+                switch (n.kind)
+                {
+                case hnode_kind::leaf:
+                    return monomial(h, h.mons[n.lhs]);
+                case hnode_kind::sum:
+                    return '(' + node(h, n.lhs) + " + " + node(h, n.rhs) + ')';
+                default:
+                    return '(' + value(n.lhs) + " * " + node(h, n.rhs) + ')';
+                }
+            }
+
+            // Mirrors compute_products
+            template <typename H>
+            void products(std::ostream& os, H const& h)
+            {
+                for (width_t i = 0; i != h.count; ++i)
+                {
+                    os << "    " << type_name<F> << " const " << value(hoist_base + i) << " = "
+                       << value(h.products[i].lhs) << " * " << value(h.products[i].rhs) << ";\n";
+                }
+            }
+
+            // Mirrors compute_temp
+            template <typename H>
+            void temp(std::ostream& os, H const& h, width_t count, width_t id)
+            {
+                for (width_t i = 0; i != count; ++i)
+                {
+                    os << "    " << type_name<F> << " const " << value(id + i) << " = "
+                       << node(h, h.roots[i]) << ";\n";
+                }
+            }
+
+            // Mirrors the evaluation of a sine and cosine pair by finalize_temps (see apply_sincos)
+            template <typename H>
+            void sincos(std::ostream& os, H const& h, width_t sin_id, width_t cos_id)
+            {
+                uses_cmath        = true;
+                uses_closed_forms = true;
+                os << "    " << type_name<F> << ' ' << value(sin_id) << ", " << value(cos_id)
+                   << ";\n    ::gal::sincos(" << node(h, h.roots[0]) << ", " << value(sin_id)
+                   << ", " << value(cos_id) << ");\n";
+            }
+
+            // Mirrors the evaluation of a closed form by finalize_temps
+            template <typename H>
+            void closed_form(std::ostream& os, H const& h, mv_op o, width_t id)
+            {
+                uses_cmath        = true;
+                uses_closed_forms = true;
+                width_t results   = o == mv_op::exp_even ? 3 : 2;
+                os << "    " << type_name<F> << ' ';
+                for (width_t i = 0; i != results; ++i)
+                {
+                    os << (i == 0 ? "" : ", ") << value(id + i);
+                }
+                os << ";\n    ::gal::" << (o == mv_op::exp_even ? "exp_closed(" : "log_closed(")
+                   << node(h, h.roots[0]);
+                for (width_t i = 0; i != results; ++i)
+                {
+                    os << ", " << value(id + i);
+                }
+                os << ");\n";
+            }
+
+            // Mirrors compute_entity
+            template <typename H>
+            void result(std::ostream& os, H const& h, width_t count, rat scale)
+            {
+                for (width_t i = 0; i != count; ++i)
+                {
+                    // The scaling factor applies to the evaluated term
+                    std::string value = '(' + node(h, h.roots[i]) + ')';
+                    if (abs(scale.den) > 1)
+                    {
+                        if (abs(scale.num) > 1 || scale.num == -1)
+                        {
+                            value = literal(static_cast<F>(scale.num) / static_cast<F>(scale.den))
+                                    + " * " + value;
+                        }
+                        else
+                        {
+                            value = value + " / " + literal(static_cast<F>(scale.den));
+                        }
+                    }
+                    else if (abs(scale.num) > 1 || scale.num == -1)
+                    {
+                        value = literal(static_cast<F>(scale.num)) + " * " + value;
+                    }
+                    os << "    out[" << i << "] = " << value << ";\n";
+                }
+            }
+        };
+
+        template <typename A, typename F, auto const& temps, width_t Base, size_t I>
+        void emit_temp(printer<F>& p, std::ostream& os)
+        {
+            constexpr size_t count = std::decay_t<decltype(temps)>::size();
+            constexpr size_t partner
+                = ::gal::detail::sincos_partner<temps, I>(std::make_index_sequence<count>{});
+            constexpr mv_op o = temps.template get<I>().ie.o;
+            if constexpr (::gal::detail::is_closed_form_tail(o))
+            {
+                // Printed with the first result of the closed form
+            }
+            else if constexpr (::gal::detail::is_closed_form(o))
+            {
+                using r = ::gal::detail::
+                    reified<A, ::gal::detail::temp_argument<temps, I>::value, Base>;
+                p.products(os, r::hoisted);
+                p.closed_form(os, r::horner, o, temps.template get<I>().id);
+                p.hoist_offset += r::hoisted.count;
+            }
+            else if constexpr (partner == count)
+            {
+                using r = ::gal::detail::reified<A, ::gal::detail::temp_ie<temps, I>::value, Base>;
+                p.products(os, r::hoisted);
+                p.temp(os, r::horner, r::form.size.term, temps.template get<I>().id);
+                p.hoist_offset += r::hoisted.count;
+            }
+            else if constexpr (partner > I)
+            {
+                // Both temporaries are printed here as the argument is already available (the later
+                // of the pair prints nothing)
+                using r = ::gal::detail::
+                    reified<A, ::gal::detail::temp_argument<temps, I>::value, Base>;
+                constexpr width_t id    = temps.template get<I>().id;
+                constexpr width_t other = temps.template get<partner>().id;
+                p.products(os, r::hoisted);
+                if constexpr (o == mv_op::sin)
+                {
+                    p.sincos(os, r::horner, id, other);
+                }
+                else
+                {
+                    p.sincos(os, r::horner, other, id);
+                }
+                p.hoist_offset += r::hoisted.count;
+            }
+        }
+
+        template <typename A, typename F, auto const& temps, width_t Base, size_t... I>
+        void emit_temps(printer<F>& p, std::ostream& os, std::index_sequence<I...>)
+        {
+            (emit_temp<A, F, temps, Base, I>(p, os), ...);
+        }
+    } // namespace detail
+
+    // Collects generated kernels and writes them to <name>.hpp and <name>.cpp, declared in a
+    // namespace of the same name. Each kernel has the signature
+    //     void kernel(T const* in, T* out) noexcept;
+    // where the inputs are the flattened components of each argument in order, and the outputs
+    // are the components of the result, identified by <kernel>_elements.
+    class registry
+    {
+    public:
+        explicit registry(std::string name)
+            : name_{std::move(name)}
+        {}
+
+        template <typename A, typename... Data, typename L>
+        void add(char const* kernel, L lambda)
+        {
+            static_assert(sizeof...(Data) > 0, "Kernels without any inputs are not permitted");
+            using V = typename ::gal::detail::infer_field<Data...>::value_t;
+            static_assert(std::is_floating_point_v<V>,
+                          "Kernels are generated over scalar floating point value types");
+
+            // See compute in engine.hpp
+            constexpr static auto entities   = ::gal::detail::rpne_entities<A, Data...>();
+            constexpr static auto expression = std::apply(lambda, entities.first);
+            constexpr static auto rpn        = ::gal::detail::rpne_concat<expression>();
+
+            constexpr static auto reshaped    = ::gal::detail::rpn_reshape(rpn);
+            constexpr static rat scale_factor = reshaped.q;
+
+            constexpr static auto id_count = ::gal::detail::rpn_id_count(reshaped);
+            constexpr static auto flattened
+                = ::gal::detail::rpn_ids(reshaped, std::integral_constant<width_t, id_count>{});
+            constexpr static auto ids     = flattened.first;
+            constexpr static auto indices = flattened.second;
+            constexpr static auto inputs  = ::gal::detail::rpn_inputs<A, ids, indices, Data...>{}(
+                std::make_index_sequence<ids.size()>{});
+
+            constexpr static ::gal::detail::rpn_state input_state{
+                inputs, tuple<>{}, tuple<>{}, entities.second.first};
+            constexpr static auto const& processed
+                = ::gal::detail::rpn_ctx<reshaped, 0, reshaped.count, input_state>::state;
+            constexpr static auto relations = ::gal::detail::input_relations<A, Data...>();
+            constexpr static auto temps = ::gal::detail::relate_temps<relations, processed>();
+            constexpr static auto args  = ::gal::detail::relate_args<relations, processed>();
+            static_assert(decltype(processed.args)::size() <= 1,
+                          "Kernels must produce a single result");
+
+            constexpr width_t input_size = (::gal::detail::data_size<Data>() + ...);
+            constexpr static width_t base
+                = input_size + processed.id_count - entities.second.first;
+            detail::printer<V> p{input_size, base};
+            char const* type = detail::type_name<V>;
+
+            source_ << "void " << kernel << '(' << type << " const* in, " << type
+                    << "* out) noexcept\n{\n";
+            detail::emit_temps<A, V, temps, base>(
+                p, source_, std::make_index_sequence<std::decay_t<decltype(temps)>::size()>{});
+
+            width_t output_size = 0;
+            header_ << "\n    constexpr unsigned " << kernel << "_input_size = " << input_size
+                    << ";\n";
+            if constexpr (decltype(processed.args)::size() == 1)
+            {
+                using r = ::gal::detail::reified<A, ::gal::detail::result_ie<args, 0>::value, base>;
+                constexpr static auto const& result = r::form;
+                output_size                         = result.size.term;
+                p.products(source_, r::hoisted);
+                p.result(source_, r::horner, output_size, scale_factor);
+
+                if (output_size > 0)
+                {
+                    header_ << "    constexpr unsigned " << kernel << "_elements[] = {";
+                    for (width_t i = 0; i != output_size; ++i)
+                    {
+                        header_ << (i == 0 ? "" : ", ") << result.terms[i].element;
+                    }
+                    header_ << "};\n";
+                }
+            }
+            header_ << "    constexpr unsigned " << kernel << "_output_size = " << output_size
+                    << ";\n";
+            header_ << "    void " << kernel << '(' << type << " const* in, " << type
+                    << "* out) noexcept;\n";
+            source_ << "}\n\n";
+            uses_cmath_        = uses_cmath_ || p.uses_cmath;
+            uses_closed_forms_ = uses_closed_forms_ || p.uses_closed_forms;
+        }
+
+        // Writes the generated header and source to the supplied directory
+        [[nodiscard]] bool write(std::string const& directory) const
+        {
+            std::ofstream header{directory + '/' + name_ + ".hpp"};
+            header << "#pragma once\n\n// Generated by gal_codegen. Do not edit.\n\nnamespace "
+                   << name_ << "\n{" << header_.str() << "} // namespace " << name_ << '\n';
+
+            std::ofstream source{directory + '/' + name_ + ".cpp"};
+            source << "// Generated by gal_codegen. Do not edit.\n\n#include \"" << name_
+                   << ".hpp\"\n\n";
+            if (uses_cmath_)
+            {
+                source << "#include <cmath>\n";
+                if (uses_closed_forms_)
+                {
+                    source << "#include <gal/closed_forms.hpp>\n";
+                }
+                source << '\n';
+            }
+            source << "namespace " << name_ << "\n{\n";
+            source << source_.str() << "} // namespace " << name_ << '\n';
+            return static_cast<bool>(header) && static_cast<bool>(source);
+        }
+
+    private:
+        std::string name_;
+        std::ostringstream header_;
+        std::ostringstream source_;
+        bool uses_cmath_        = false;
+        bool uses_closed_forms_ = false;
+    };
+} // namespace codegen
+} // namespace gal
+
+// Defined by the translation unit registering kernels with a gal_codegen executable
+void gal_codegen_register(gal::codegen::registry& registry);
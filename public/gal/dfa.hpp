@@ -81,7 +81,7 @@ namespace detail
         template <typename I>
         constexpr auto ie(uint32_t id) noexcept
         {
-            if constexpr (std::is_floating_point_v<I>)
+            if constexpr (detail::is_field_v<I>)
             {
                 return mv<A, 1, 1, 1>{
                     mv_size{1, 1, 1}, {ind{id, one}}, {mon{one, one, 1, 0}}, {term{1, 0, 0}}};
@@ -143,10 +143,26 @@ namespace detail
         bool required       = false;
     };
 
+    // Subexpressions are indexed by an open addressing table keyed on their checksums, sized to
+    // at least twice the capacity so probe sequences stay short
+    [[nodiscard]] constexpr width_t cse_table_size(width_t capacity) noexcept
+    {
+        width_t size = 2;
+        while (size < 2 * capacity)
+        {
+            size *= 2;
+        }
+        return size;
+    }
+
     template <width_t C>
     struct cses
     {
+        constexpr static width_t table_size = cse_table_size(C);
+
         cse ses[C];
+        // Each slot holds one plus the index of a subexpression in ses (zero marks an empty slot)
+        width_t slots[table_size] = {};
         width_t count = 0;
     };
 
@@ -207,7 +223,7 @@ namespace detail
     }
 
     // Given a subexpression, increment its counter if it was registered previously. Otherwise,
-    // append it.
+    // append it. Only subexpressions sharing a slot chain are compared node by node.
     template <typename A, width_t C>
     constexpr width_t register_se(rpne<A, C> const& exp,
                                   cses<C>& known,
@@ -217,18 +233,21 @@ namespace detail
                                   bool required) noexcept
     {
         cse next{crc, offset, count, 1, 0, required};
-        for (width_t i = 0; i != known.count; ++i)
+        width_t slot = crc & (cses<C>::table_size - 1);
+        while (known.slots[slot] != 0)
         {
-            auto& known_se = known.ses[i];
+            auto& known_se = known.ses[known.slots[slot] - 1];
             if (compare_se(known, exp, known_se, next))
             {
                 ++known_se.refs;
                 known_se.required = required || known_se.required;
-                return i + 1;
+                return known.slots[slot];
             }
+            slot = (slot + 1) & (cses<C>::table_size - 1);
         }
 
         known.ses[known.count++] = next;
+        known.slots[slot]        = known.count;
         return 0;
     }
 
@@ -334,8 +353,11 @@ namespace detail
             case op_sqrt:
             case op_sin:
             case op_cos:
+            case op_tan:
+            case op_sign:
+            case op_exp:
                 // fallthrough
-            case op_tan: {
+            case op_log: {
                 width_t offset = offsets.peek();
 
                 // Check if the argument has been extracted. If not, mark it as required.
@@ -581,6 +603,15 @@ namespace detail
             }
         }
 
+        // The subexpressions holding the results of a tuple are not closed by a polyadic op, so
+        // each one extends to the start of the next (or the end of the expression)
+        for (width_t k = 0; k != se_stack.count; ++k)
+        {
+            auto [se, offset]   = se_stack[k];
+            width_t next_offset = k + 1 == se_stack.count ? out.count + 1 : se_stack[k + 1].second;
+            se->ex              = next_offset - offset - 1;
+        }
+
         out.q = expr.q;
         return out;
     }
@@ -600,6 +631,247 @@ namespace detail
     template <typename I, typename T, typename M>
     rpn_state(I, T, M, uint32_t)->rpn_state<I, T, M>;
 
+    // Temporaries appended by closed forms (see closed_form) are interleaved with those holding
+    // common subexpressions, so op_cse indices only count the temporaries appended by op_noop
+    template <typename T, size_t... I>
+    [[nodiscard]] constexpr size_t
+    cse_temp_index(T const& temps, width_t index, std::index_sequence<I...>) noexcept
+    {
+        op const ops[] = {temps.template get<I>().o..., op_noop};
+        for (size_t i = 0; i != sizeof...(I); ++i)
+        {
+            if (ops[i] == op_noop)
+            {
+                if (index == 0)
+                {
+                    return i;
+                }
+                --index;
+            }
+        }
+        return sizeof...(I);
+    }
+
+    template <typename A, width_t I, width_t M, width_t T>
+    [[nodiscard]] constexpr auto with_op(mv<A, I, M, T> in, mv_op o) noexcept
+    {
+        in.o = o;
+        return in;
+    }
+
+    // Reifies op_exp and op_log (see exp and log in expr.hpp). The scalar argument of the closed
+    // form is evaluated as a temporary unless it is already a single monomial (the closed forms are
+    // applied per monomial like the other transcendentals), followed by a temporary for each of the
+    // scalars the closed form yields. The argument is reduced symbolically first, so a closed form
+    // whose argument vanishes identically reduces to rational constants instead.
+    template <auto const& exp, width_t i, auto const& State>
+    struct closed_form
+    {
+        using algebra_t = typename std::decay_t<decltype(exp)>::algebra_t;
+
+        constexpr static auto const& n   = exp.nodes[i];
+        constexpr static bool is_exp     = n.o == op_exp;
+        constexpr static elem_t ps       = (1 << algebra_t::metric_t::dimension) - 1;
+        constexpr static auto pop        = State.args.pop();
+        constexpr static uint32_t id     = State.id_count;
+        constexpr static width_t results = is_exp ? 3 : 2;
+
+        [[nodiscard]] constexpr static auto scaled_input() noexcept
+        {
+            auto out = pop.first.second;
+            out.scale(n.q);
+            return out;
+        }
+
+        constexpr static auto in = scaled_input();
+
+        // B^2 for exp (its scalar and pseudoscalar parts are -x and p)
+        [[nodiscard]] constexpr static auto square() noexcept
+        {
+            if constexpr (is_exp)
+            {
+                constexpr auto out = product(typename algebra_t::geometric{}, in, in);
+                return out.template resize<out.size.ind, out.size.mon, out.size.term>();
+            }
+            else
+            {
+                return in;
+            }
+        }
+
+        constexpr static auto squared = square();
+
+        [[nodiscard]] constexpr static auto argument() noexcept
+        {
+            constexpr auto s = squared[0];
+            auto out         = s.template resize<s.size.ind, s.size.mon, s.size.term>();
+            if constexpr (is_exp)
+            {
+                out.scale(minus_one);
+            }
+            return out;
+        }
+
+        // Coefficient of the pseudoscalar (halved for exp)
+        [[nodiscard]] constexpr static auto dual_coefficient() noexcept
+        {
+            constexpr auto p = squared[ps];
+            auto out         = p.template resize<p.size.ind, p.size.mon, p.size.term>();
+            if constexpr (is_exp)
+            {
+                out.scale(one_half);
+            }
+            return out;
+        }
+
+        constexpr static auto x          = argument();
+        constexpr static auto p          = dual_coefficient();
+        constexpr static bool is_zero    = x.size.term == 0;
+        constexpr static bool is_extract = x.size.mon > 1;
+        constexpr static uint32_t first  = is_extract ? id + 1 : id;
+
+        // The scalar argument as seen by the closed form
+        [[nodiscard]] constexpr static auto reference() noexcept
+        {
+            if constexpr (is_extract)
+            {
+                return x.create_ref(id);
+            }
+            else
+            {
+                return x;
+            }
+        }
+
+        constexpr static auto arg = reference();
+
+        // Result k of the closed form
+        template <width_t K>
+        [[nodiscard]] constexpr static auto value() noexcept
+        {
+            if constexpr (!is_zero)
+            {
+                return mv<algebra_t, 1, 1, 1>{mv_size{1, 1, 1},
+                                              {ind{first + K, one}},
+                                              {mon{one, one, 1, 0}},
+                                              {term{1, 0, 0}}};
+            }
+            else if constexpr (!is_exp && K == 0)
+            {
+                // t / sin(t) at t = pi / 2
+                return mv<algebra_t, 1, 1, 1>{
+                    mv_size{1, 1, 1},
+                    {ind{ind_constant_start + c_pi - c_const_start, one}},
+                    {mon{one_half, one, 1, 0}},
+                    {term{1, 0, 0}}};
+            }
+            else
+            {
+                // The limits at zero of exp_closed, and 1 for the dual term of log_closed
+                constexpr rat q = is_exp && K == 2 ? rat{-1, 3} : one;
+                return mv<algebra_t, 0, 1, 1>{
+                    mv_size{0, 1, 1}, {}, {mon{q, zero, 0, 0}}, {term{1, 0, 0}}};
+            }
+        }
+
+        constexpr static mv<algebra_t, 0, 1, 1> pseudoscalar{
+            mv_size{0, 1, 1}, {}, {mon{one, zero, 0, 0}}, {term{1, 0, ps}}};
+
+        template <typename L, typename R>
+        [[nodiscard]] constexpr static auto gp(L const& lhs, R const& rhs) noexcept
+        {
+            return product(typename algebra_t::geometric{}, lhs, rhs);
+        }
+
+        // The multivector for exp or log, in terms of the values of the closed form
+        [[nodiscard]] constexpr static auto reify() noexcept
+        {
+            if constexpr (is_exp)
+            {
+                // C + p/2 * S * I + S * B - p/2 * G * I * B
+                constexpr auto even = value<0>();
+                constexpr auto odd  = value<1>();
+                constexpr auto dual = value<2>();
+                constexpr auto t1   = gp(gp(p, odd), pseudoscalar);
+                constexpr auto t2   = gp(odd, in);
+                constexpr auto ib   = gp(pseudoscalar, in);
+                constexpr auto t3
+                    = gp(gp(p, dual), ib.template resize<ib.size.ind, ib.size.mon, ib.size.term>());
+                auto t4             = t3.template resize<t3.size.ind, t3.size.mon, t3.size.term>();
+                t4.scale(minus_one);
+                return sum_n(even,
+                             t1.template resize<t1.size.ind, t1.size.mon, t1.size.term>(),
+                             t2.template resize<t2.size.ind, t2.size.mon, t2.size.term>(),
+                             t4);
+            }
+            else
+            {
+                // F * L - p * H * I * L
+                constexpr auto odd  = value<0>();
+                constexpr auto dual = value<1>();
+                constexpr auto l    = in.select_grade(2);
+                constexpr auto t1   = gp(odd, l);
+                constexpr auto il   = gp(pseudoscalar, l);
+                constexpr auto t2
+                    = gp(gp(p, dual), il.template resize<il.size.ind, il.size.mon, il.size.term>());
+                auto t3             = t2.template resize<t2.size.ind, t2.size.mon, t2.size.term>();
+                t3.scale(minus_one);
+                return sum_n(t1.template resize<t1.size.ind, t1.size.mon, t1.size.term>(), t3);
+            }
+        }
+
+        constexpr static auto reified = reify();
+
+        template <width_t K>
+        [[nodiscard]] constexpr static auto result_temp() noexcept
+        {
+            constexpr mv_op o = is_exp ? (K == 0 ? mv_op::exp_even
+                                                 : K == 1 ? mv_op::exp_odd : mv_op::exp_dual)
+                                       : (K == 0 ? mv_op::log_odd : mv_op::log_dual);
+            return rpn_temp{with_op(arg, o), static_cast<op>(n.o), n.checksum, first + K};
+        }
+
+        [[nodiscard]] constexpr static auto temps() noexcept
+        {
+            if constexpr (is_zero)
+            {
+                return State.temps;
+            }
+            else
+            {
+                constexpr auto argument_temps = [] {
+                    if constexpr (is_extract)
+                    {
+                        return State.temps.append(
+                            rpn_temp{x, static_cast<op>(n.o), n.checksum, id});
+                    }
+                    else
+                    {
+                        return State.temps;
+                    }
+                }();
+                constexpr auto out
+                    = argument_temps.append(result_temp<0>()).append(result_temp<1>());
+                if constexpr (is_exp)
+                {
+                    return out.append(result_temp<2>());
+                }
+                else
+                {
+                    return out;
+                }
+            }
+        }
+
+        constexpr static rpn_state state{
+            State.inputs,
+            temps(),
+            pop.second.push(make_pair(
+                n.checksum,
+                reified.template resize<reified.size.ind, reified.size.mon, reified.size.term>())),
+            is_zero ? id : first + results};
+    };
+
     // We thread the expression and evaluation index through as type parameters here to permit
     // heterogeneous return types.
     template <auto const& exp, width_t i, width_t l, auto const& State>
@@ -636,7 +908,11 @@ namespace detail
             }
             else if constexpr (n.o == op_cse)
             {
-                auto const& temp = State.temps.template get<n.ex>();
+                constexpr size_t index = cse_temp_index(
+                    State.temps,
+                    n.ex,
+                    std::make_index_sequence<std::decay_t<decltype(State.temps)>::size()>{});
+                auto const& temp = State.temps.template get<index>();
                 return rpn_state{State.inputs,
                                  State.temps,
                                  State.args.push(make_pair(n.checksum, temp.ie.create_ref(temp.id))),
@@ -693,7 +969,7 @@ namespace detail
             {
                 constexpr auto split = State.args.template split<n.ex>();
                 constexpr auto sum
-                    = split.first.apply([](auto... args) { return (args.second + ...); });
+                    = split.first.apply([](auto... args) { return sum_n(args.second...); });
                 return rpn_state{
                     State.inputs,
                     State.temps,
@@ -790,6 +1066,17 @@ namespace detail
                 args.template get<0>().second.tan(n.q);
                 return rpn_state{State.inputs, State.temps, args, State.id_count};
             }
+            else if constexpr (n.o == op_sign)
+            {
+                auto args                    = State.args;
+                args.template get<0>().first = n.checksum;
+                args.template get<0>().second.sign(n.q);
+                return rpn_state{State.inputs, State.temps, args, State.id_count};
+            }
+            else if constexpr (n.o == op_exp || n.o == op_log)
+            {
+                return closed_form<exp, i, State>::state;
+            }
             else if constexpr (n.o == op_comp)
             {
                 constexpr auto pop  = State.args.pop();
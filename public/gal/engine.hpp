@@ -1,14 +1,43 @@
 #pragma once
 
+#include "aosoa.hpp"
 #include "dfa.hpp"
 #include "entity.hpp"
+#include "simd.hpp"
+#include "span.hpp"
 
+#include <algorithm>
 #include <cmath>
 #include <tuple>
 #include <type_traits>
 
 namespace gal
 {
+// The operations performed by a reified computation (see evaluate::cost). Counts reflect the code
+// as instantiated, before the compiler merges identical subexpressions or contracts multiplies and
+// adds. Subtraction is a sum with a negated coefficient and is counted as such.
+struct op_count
+{
+    width_t add  = 0;
+    width_t mul  = 0;
+    width_t div  = 0;
+    width_t sqrt = 0;
+    width_t sin  = 0;
+    width_t cos  = 0;
+    width_t tan  = 0;
+    width_t sign = 0; // Selections of 1 or -1 by the sign bit
+    // Sines and cosines of the same argument evaluated together (not included in sin and cos)
+    width_t sincos = 0;
+    width_t pow  = 0; // Fractional exponents
+    // Closed forms of exp and log (see exp_closed and log_closed), each yielding every scalar the
+    // exponential or logarithm needs
+    width_t exp = 0;
+    width_t log = 0;
+    // Values stored to the data array (terms of temporaries and hoisted products)
+    width_t temps = 0;
+    width_t terms = 0; // Terms of the result(s)
+};
+
 namespace detail
 {
     // The indeterminate value is either a pointer to an entity's value or an evaluated expression
@@ -38,7 +67,7 @@ namespace detail
     template <typename T, typename D, typename... Ds>
     GAL_FORCE_INLINE constexpr static void fill(T* out, D const& datum, Ds const&... data) noexcept
     {
-        if constexpr (std::is_floating_point_v<D>)
+        if constexpr (detail::is_field_v<D>)
         {
             auto& iv      = *out;
             iv.is_pointer = true;
@@ -56,7 +85,7 @@ namespace detail
 
         if constexpr (sizeof...(Ds) > 0)
         {
-            if constexpr (std::is_floating_point_v<D>)
+            if constexpr (detail::is_field_v<D>)
             {
                 fill(out + 1, data...);
             }
@@ -71,48 +100,121 @@ namespace detail
     struct cmon
     {};
 
+    // Converts a compile-time rational to the value type (broadcast if F holds SIMD lanes)
+    template <typename F>
+    [[nodiscard]] GAL_FORCE_INLINE constexpr F rat_cast(rat q) noexcept
+    {
+        return F{static_cast<scalar_t<F>>(q)};
+    }
+
+    // Transcendentals are called unqualified so that value types with their own overloads (e.g.
+    // SIMD lanes) are found via argument dependent lookup.
     template <typename F, mv_op Op>
     GAL_FORCE_INLINE constexpr F apply_mv_op(F in)
     {
+        using std::cos;
+        using std::sin;
+        using std::sqrt;
+        using std::tan;
+
         if constexpr (Op == mv_op::id)
         {
             return in;
         }
         else if constexpr (Op == mv_op::sin)
         {
-            return std::sin(in);
+            return sin(in);
         }
         else if constexpr (Op == mv_op::cos)
         {
-            return std::cos(in);
+            return cos(in);
         }
         else if constexpr (Op == mv_op::tan)
         {
-            return std::tan(in);
+            return tan(in);
         }
         else if constexpr (Op == mv_op::sqrt)
         {
-            return std::sqrt(in);
+            return sqrt(in);
+        }
+        else if constexpr (Op == mv_op::sign)
+        {
+            return sign(in);
+        }
+        else if constexpr (Op == mv_op::exp_even)
+        {
+            return exp_even(in);
+        }
+        else if constexpr (Op == mv_op::exp_odd)
+        {
+            return exp_odd(in);
+        }
+        else if constexpr (Op == mv_op::exp_dual)
+        {
+            return exp_dual(in);
+        }
+        else if constexpr (Op == mv_op::log_odd)
+        {
+            return log_odd(in);
+        }
+        else if constexpr (Op == mv_op::log_dual)
+        {
+            return log_dual(in);
         }
     }
 
-    template <typename F, auto const& ie, width_t Index, size_t... I>
-    struct cmon<F, ie, Index, std::index_sequence<I...>>
+    template <typename F, typename D>
+    GAL_FORCE_INLINE constexpr static F data_value(D const& data, width_t id) noexcept
     {
-        GAL_FORCE_INLINE constexpr static F data_value(ind_value<F> const* data, width_t id) noexcept
+        if (id >= ind_constant_start)
         {
-            if (id >= ind_constant_start)
-            {
-                return ind_constants<F>[id - ind_constant_start];
-            }
-            else
-            {
-                return *data[id];
-            }
+            return F{ind_constants<scalar_t<F>>[id - ind_constant_start]};
+        }
+        else
+        {
+            return *data[id];
+        }
+    }
+
+    template <typename F, typename = void>
+    struct has_sincos : std::false_type
+    {};
+
+    template <typename F>
+    struct has_sincos<F,
+                      std::void_t<decltype(sincos(
+                          std::declval<F const&>(), std::declval<F&>(), std::declval<F&>()))>>
+        : std::true_type
+    {};
+
+    // Floating-point values use gal::sincos (see closed_forms.hpp), and other value types may
+    // provide their own found via argument dependent lookup. Otherwise, sin and cos are called
+    // separately.
+    template <typename F>
+    GAL_FORCE_INLINE constexpr void apply_sincos(F in, F& s, F& c)
+    {
+        if constexpr (std::is_floating_point_v<F>)
+        {
+            ::gal::sincos(in, s, c);
+        }
+        else if constexpr (has_sincos<F>::value)
+        {
+            sincos(in, s, c);
+        }
+        else
+        {
+            using std::cos;
+            using std::sin;
+            s = sin(in);
+            c = cos(in);
         }
+    }
 
-        template <size_t N>
-        GAL_FORCE_INLINE constexpr static F value(std::array<ind_value<F>, N> const& data) noexcept
+    template <typename F, auto const& ie, width_t Index, size_t... I>
+    struct cmon<F, ie, Index, std::index_sequence<I...>>
+    {
+        template <typename D>
+        GAL_FORCE_INLINE constexpr static F value(D const& data) noexcept
         {
             constexpr auto m = ie.mons[Index];
             if constexpr (m.q.is_zero())
@@ -121,7 +223,7 @@ namespace detail
             }
             else if constexpr (sizeof...(I) == 0)
             {
-                return apply_mv_op<F, ie.o>(static_cast<F>(m.q));
+                return apply_mv_op<F, ie.o>(rat_cast<F>(m.q));
             }
             else
             {
@@ -130,9 +232,9 @@ namespace detail
                     if constexpr (abs(m.q.num) > 1 || m.q.num == -1)
                     {
                         return apply_mv_op<F, ie.o>(
-                            static_cast<F>(m.q)
+                            rat_cast<F>(m.q)
                             * (::gal::pow(
-                                   data_value(data.data(), ie.inds[m.ind_offset + I].id),
+                                   data_value<F>(data, ie.inds[m.ind_offset + I].id),
                                    std::integral_constant<int, ie.inds[m.ind_offset + I].degree.num>{},
                                    std::integral_constant<int, ie.inds[m.ind_offset + I].degree.den>{})
                                * ...));
@@ -141,7 +243,7 @@ namespace detail
                     {
                         return apply_mv_op<F, ie.o>(
                             (::gal::pow(
-                                 data_value(data.data(), ie.inds[m.ind_offset + I].id),
+                                 data_value<F>(data, ie.inds[m.ind_offset + I].id),
                                  std::integral_constant<int, ie.inds[m.ind_offset + I].degree.num>{},
                                  std::integral_constant<int, ie.inds[m.ind_offset + I].degree.den>{})
                              * ...)
@@ -153,7 +255,7 @@ namespace detail
                     return apply_mv_op<F, ie.o>(
                         static_cast<F>(m.q.num)
                         * (::gal::pow(
-                               data_value(data.data(), ie.inds[m.ind_offset + I].id),
+                               data_value<F>(data, ie.inds[m.ind_offset + I].id),
                                std::integral_constant<int, ie.inds[m.ind_offset + I].degree.num>{},
                                std::integral_constant<int, ie.inds[m.ind_offset + I].degree.den>{})
                            * ...));
@@ -162,7 +264,7 @@ namespace detail
                 {
                     return apply_mv_op<F, ie.o>(
                         (::gal::pow(
-                             data_value(data.data(), ie.inds[m.ind_offset + I].id),
+                             data_value<F>(data, ie.inds[m.ind_offset + I].id),
                              std::integral_constant<int, ie.inds[m.ind_offset + I].degree.num>{},
                              std::integral_constant<int, ie.inds[m.ind_offset + I].degree.den>{})
                          * ...));
@@ -171,24 +273,45 @@ namespace detail
         }
     };
 
-    template <typename, auto const&, size_t, typename>
+    template <typename F, auto const& h, width_t Node>
     struct cterm
-    {};
-
-    template <typename F, auto const& ie, size_t Offset, size_t... I>
-    struct cterm<F, ie, Offset, std::index_sequence<I...>>
     {
-        template <size_t N>
-        GAL_FORCE_INLINE constexpr static F value(std::array<ind_value<F>, N> const& data) noexcept
+        template <typename D>
+        GAL_FORCE_INLINE constexpr static F value(D const& data) noexcept
         {
-            return (
-                cmon<F, ie, Offset + I, std::make_index_sequence<ie.mons[Offset + I].count>>::value(data)
-                + ...);
+            constexpr hnode n = h.nodes[Node];
+            if constexpr (n.kind == hnode_kind::leaf)
+            {
+                return cmon<F, h, n.lhs, std::make_index_sequence<h.mons[n.lhs].count>>::value(
+                    data);
+            }
+            else if constexpr (n.kind == hnode_kind::sum)
+            {
+                return cterm<F, h, n.lhs>::value(data) + cterm<F, h, n.rhs>::value(data);
+            }
+            else
+            {
+                return data_value<F>(data, n.lhs) * cterm<F, h, n.rhs>::value(data);
+            }
         }
     };
 
-    template <auto const& ie, typename F, typename A, size_t N, num_t Num, den_t Den, size_t... I>
-    GAL_FORCE_INLINE constexpr static auto compute_entity(std::array<ind_value<F>, N> const& data,
+    // Evaluates term I of a factored multivector
+    template <typename F, auto const& h, size_t I, typename D>
+    GAL_FORCE_INLINE constexpr static F term_value(D const& data) noexcept
+    {
+        return cterm<F, h, h.roots[I]>::value(data);
+    }
+
+    template <auto const& ie,
+              auto const& h,
+              typename F,
+              typename A,
+              typename D,
+              num_t Num,
+              den_t Den,
+              size_t... I>
+    GAL_FORCE_INLINE constexpr static auto compute_entity(D const& data,
                                                           std::integral_constant<num_t, Num>,
                                                           std::integral_constant<den_t, Den>,
                                                           std::index_sequence<I...>) noexcept
@@ -204,41 +327,31 @@ namespace detail
             {
                 if constexpr (abs(Num) > 1 || Num == -1)
                 {
-                    return entity_t{(
-                        static_cast<F>(Num) / static_cast<F>(Den)
-                        * cterm<F, ie, ie.terms[I].mon_offset, std::make_index_sequence<ie.terms[I].count>>::value(
-                            data))...};
+                    return entity_t{(static_cast<F>(Num) / static_cast<F>(Den)
+                                     * term_value<F, h, I>(data))...};
                 }
                 else
                 {
-                    return entity_t{(
-                        cterm<F, ie, ie.terms[I].mon_offset, std::make_index_sequence<ie.terms[I].count>>::value(
-                            data)
-                        / static_cast<F>(Den))...};
+                    return entity_t{(term_value<F, h, I>(data) / static_cast<F>(Den))...};
                 }
             }
             else
             {
                 if constexpr (abs(Num) > 1 || Num == -1)
                 {
-                    return entity_t{(
-                        static_cast<F>(Num)
-                        * cterm<F, ie, ie.terms[I].mon_offset, std::make_index_sequence<ie.terms[I].count>>::value(
-                            data))...};
+                    return entity_t{(static_cast<F>(Num) * term_value<F, h, I>(data))...};
                 }
                 else
                 {
-                    return entity_t{(
-                        cterm<F, ie, ie.terms[I].mon_offset, std::make_index_sequence<ie.terms[I].count>>::value(
-                            data))...};
+                    return entity_t{term_value<F, h, I>(data)...};
                 }
             }
         }
     }
 
-    template <auto const& ie, auto o, typename F, typename A, size_t N, size_t... I>
+    template <auto const& h, auto o, typename F, typename A, typename D, size_t... I>
     GAL_FORCE_INLINE constexpr static void
-    compute_temp(std::array<ind_value<F>, N>& data, std::index_sequence<I...>, size_t offset) noexcept
+    compute_temp(D& data, std::index_sequence<I...>, size_t offset) noexcept
     {
         if constexpr (sizeof...(I) == 0)
         {
@@ -246,14 +359,337 @@ namespace detail
         }
         else
         {
-            ((data[offset + I]
-              = cterm<F, ie, ie.terms[I].mon_offset, std::make_index_sequence<ie.terms[I].count>>::value(
-                  data)),
-             ...);
+            ((data[offset + I] = term_value<F, h, I>(data)), ...);
+        }
+    }
+
+    template <typename A, bool Lower = true, typename M>
+    [[nodiscard]] constexpr auto lower(M const& ie) noexcept
+    {
+        if constexpr (Lower && detail::uses_null_basis<A>)
+        {
+            return detail::to_null_basis(ie);
+        }
+        else
+        {
+            return ie;
+        }
+    }
+
+    // The form in which a multivector is evaluated: expressed in the null basis if the algebra
+    // requires it, with the products shared across its terms hoisted (see hoist in algebra.hpp)
+    // into the data array from index Base onwards, and with each term factored. Products are only
+    // hoisted if doing so reduces the estimated number of multiplications, as compilers already
+    // evaluate identical subexpressions once. Multivectors that are not elements of the algebra
+    // (such as the coefficients of a bound kernel, see bind) are evaluated without lowering.
+    template <typename A, auto const& ie, width_t Base, bool Lower = true>
+    struct reified
+    {
+        constexpr static auto lowered   = lower<A, Lower>(ie);
+        constexpr static auto candidate = hoist<hoist_table_size(lowered)>(lowered, Base);
+
+        template <typename M>
+        [[nodiscard]] constexpr static auto factored(M const& in) noexcept
+        {
+            return factor<lowered.size.ind,
+                          lowered.size.mon,
+                          horner_capacity(lowered),
+                          lowered.size.term>(in);
+        }
+
+        constexpr static auto plain_horner = factored(lowered);
+        constexpr static auto hoisted_horner
+            = candidate.count == 0 ? plain_horner : factored(candidate.ie);
+        constexpr static bool is_hoisted
+            = candidate.count != 0
+              && horner_cost(hoisted_horner) + candidate.count < horner_cost(plain_horner);
+
+        constexpr static auto hoisted = is_hoisted ? candidate : decltype(candidate){lowered};
+        constexpr static auto form    = hoisted.ie;
+        constexpr static auto horner  = is_hoisted ? hoisted_horner : plain_horner;
+    };
+
+    // Mirrors cmon::value
+    constexpr void count_mon(op_count& out, mon const& m, ind const* inds, mv_op o) noexcept
+    {
+        if (m.q.is_zero())
+        {
+            return;
+        }
+
+        if (m.count > 0)
+        {
+            out.mul += m.count - 1;
+            for (width_t i = m.ind_offset; i != m.ind_offset + m.count; ++i)
+            {
+                rat degree = inds[i].degree;
+                if (degree.den != 1)
+                {
+                    ++out.pow;
+                }
+                else if (degree.num < 0)
+                {
+                    ++out.div;
+                    out.mul += pow_muls(-degree.num);
+                }
+                else if (degree.num > 0)
+                {
+                    out.mul += pow_muls(degree.num);
+                }
+            }
+
+            if (abs(m.q.den) > 1 && abs(m.q.num) == 1 && m.q.num != -1)
+            {
+                ++out.div;
+            }
+            else if (abs(m.q.den) > 1 || abs(m.q.num) > 1 || m.q.num == -1)
+            {
+                ++out.mul;
+            }
+        }
+
+        switch (o)
+        {
+        case mv_op::sin:
+            ++out.sin;
+            break;
+        case mv_op::cos:
+            ++out.cos;
+            break;
+        case mv_op::tan:
+            ++out.tan;
+            break;
+        case mv_op::sqrt:
+            ++out.sqrt;
+            break;
+        case mv_op::sign:
+            ++out.sign;
+            break;
+        case mv_op::exp_even:
+        case mv_op::exp_odd:
+        case mv_op::exp_dual:
+            ++out.exp;
+            break;
+        case mv_op::log_odd:
+        case mv_op::log_dual:
+            ++out.log;
+            break;
+        default:
+            break;
+        }
+    }
+
+    // Mirrors compute_products and cterm::value for every term of a reified multivector
+    template <typename R>
+    constexpr void count_reified(op_count& out) noexcept
+    {
+        out.mul += R::hoisted.count;
+        for (width_t i = 0; i != R::horner.node_count; ++i)
+        {
+            hnode const& n = R::horner.nodes[i];
+            if (n.kind == hnode_kind::leaf)
+            {
+                count_mon(out, R::horner.mons[n.lhs], R::horner.inds.data(), R::horner.o);
+            }
+            else if (n.kind == hnode_kind::sum)
+            {
+                ++out.add;
+            }
+            else
+            {
+                ++out.mul;
+            }
+        }
+    }
+
+    template <auto const& temps, size_t I>
+    struct temp_ie
+    {
+        constexpr static auto value = temps.template get<I>().ie;
+    };
+
+    template <auto const& results, size_t I>
+    struct result_ie
+    {
+        constexpr static auto value = results.template get<I>().second;
+    };
+
+    // Whether the temporaries are the sine and cosine (in either order) of the same argument
+    template <typename L, typename R>
+    [[nodiscard]] constexpr bool is_sincos(L const& lhs, R const& rhs) noexcept
+    {
+        if (!((lhs.o == mv_op::sin && rhs.o == mv_op::cos)
+              || (lhs.o == mv_op::cos && rhs.o == mv_op::sin)))
+        {
+            return false;
+        }
+
+        // The operation is applied per monomial, so only single monomials are paired
+        if (lhs.size.term != 1 || lhs.size.mon != 1 || rhs.size.term != 1 || rhs.size.mon != 1
+            || lhs.size.ind != rhs.size.ind)
+        {
+            return false;
+        }
+
+        mon const& lm = lhs.mons[0];
+        mon const& rm = rhs.mons[0];
+        if (lhs.terms[0].element != rhs.terms[0].element || lm.q != rm.q || lm.count != rm.count)
+        {
+            return false;
+        }
+
+        for (width_t i = 0; i != lm.count; ++i)
+        {
+            ind const& li = lhs.inds[lm.ind_offset + i];
+            ind const& ri = rhs.inds[rm.ind_offset + i];
+            if (li.id != ri.id || li.degree != ri.degree)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Exponentials of bivectors take the sine and cosine of the same argument. Returns the index
+    // of the temporary whose sine or cosine pairs with that of temporary I, or the number of
+    // temporaries if there is none.
+    template <auto const& temps, size_t I, size_t... J>
+    [[nodiscard]] constexpr size_t sincos_partner(std::index_sequence<J...>) noexcept
+    {
+        size_t out = sizeof...(J);
+        ((out = out == sizeof...(J) && J != I
+                        && is_sincos(temps.template get<I>().ie, temps.template get<J>().ie)
+                    ? J
+                    : out),
+         ...);
+        return out;
+    }
+
+    // The argument shared by temporaries evaluated together (a sine and cosine pair or the results
+    // of a closed form)
+    template <auto const& temps, size_t I>
+    struct temp_argument
+    {
+        [[nodiscard]] constexpr static auto strip() noexcept
+        {
+            auto out = temps.template get<I>().ie;
+            out.o    = mv_op::id;
+            return out;
+        }
+
+        constexpr static auto value = strip();
+    };
+
+    // The results of a closed form (see closed_form in dfa.hpp) follow the temporary holding the
+    // first of them and are evaluated with it
+    [[nodiscard]] constexpr bool is_closed_form(mv_op o) noexcept
+    {
+        return o == mv_op::exp_even || o == mv_op::log_odd;
+    }
+
+    [[nodiscard]] constexpr bool is_closed_form_tail(mv_op o) noexcept
+    {
+        return o == mv_op::exp_odd || o == mv_op::exp_dual || o == mv_op::log_dual;
+    }
+
+    // Mirrors finalize_temps
+    template <typename A, auto const& temps, width_t Base, size_t I>
+    constexpr void count_temp(op_count& out) noexcept
+    {
+        constexpr size_t count   = std::decay_t<decltype(temps)>::size();
+        constexpr size_t partner = sincos_partner<temps, I>(std::make_index_sequence<count>{});
+        constexpr mv_op o        = temps.template get<I>().ie.o;
+        if constexpr (is_closed_form_tail(o))
+        {
+            return;
+        }
+        else if constexpr (is_closed_form(o))
+        {
+            count_reified<reified<A, temp_argument<temps, I>::value, Base>>(out);
+            ++(o == mv_op::exp_even ? out.exp : out.log);
+        }
+        else if constexpr (partner == count)
+        {
+            count_reified<reified<A, temp_ie<temps, I>::value, Base>>(out);
+        }
+        else if constexpr (partner > I)
+        {
+            count_reified<reified<A, temp_argument<temps, I>::value, Base>>(out);
+            ++out.sincos;
+        }
+    }
+
+    // Hoisted products are only referenced by the multivector they were hoisted from, so every
+    // multivector reuses the same slots
+    template <typename A,
+              auto const& temps,
+              auto const& results,
+              width_t Base,
+              size_t... T,
+              size_t... R>
+    [[nodiscard]] constexpr width_t
+    hoisted_slots(std::index_sequence<T...>, std::index_sequence<R...>) noexcept
+    {
+        width_t slots = 0;
+        ((slots = std::max(slots, reified<A, temp_ie<temps, T>::value, Base>::hoisted.count)), ...);
+        ((slots = std::max(slots, reified<A, result_ie<results, R>::value, Base>::hoisted.count)),
+         ...);
+        return slots;
+    }
+
+    template <typename A,
+              auto const& temps,
+              auto const& results,
+              width_t Base,
+              size_t... T,
+              size_t... R>
+    [[nodiscard]] constexpr op_count
+    count_ops(rat scale, std::index_sequence<T...>, std::index_sequence<R...>) noexcept
+    {
+        op_count out{};
+        (count_temp<A, temps, Base, T>(out), ...);
+        ((out.temps += reified<A, temp_ie<temps, T>::value, Base>::form.size.term
+                       + reified<A, temp_ie<temps, T>::value, Base>::hoisted.count),
+         ...);
+        (count_reified<reified<A, result_ie<results, R>::value, Base>>(out), ...);
+        ((out.temps += reified<A, result_ie<results, R>::value, Base>::hoisted.count), ...);
+        ((out.terms += reified<A, result_ie<results, R>::value, Base>::form.size.term), ...);
+
+        // Mirrors the scaling applied to each term by compute_entity
+        if (abs(scale.den) > 1 && abs(scale.num) == 1 && scale.num != -1)
+        {
+            out.div += out.terms;
+        }
+        else if (abs(scale.den) > 1 || abs(scale.num) > 1 || scale.num == -1)
+        {
+            out.mul += out.terms;
+        }
+        return out;
+    }
+
+    // Exposes operation counts as a constant expression so that budgets can be enforced with
+    // static_assert (the lambda supplied to evaluate::cost is not itself a constant)
+    template <auto const& C>
+    struct op_count_constant
+    {
+        constexpr static op_count value = C;
+
+        [[nodiscard]] constexpr operator op_count() const noexcept
+        {
+            return C;
         }
+    };
+
+    template <typename F, auto const& h, width_t Base, typename D, size_t... I>
+    GAL_FORCE_INLINE constexpr static void compute_products(D& data,
+                                                            std::index_sequence<I...>) noexcept
+    {
+        ((data[Base + I]
+          = data_value<F>(data, h.products[I].lhs) * data_value<F>(data, h.products[I].rhs)),
+         ...);
     }
 
-    template <typename A, typename V, auto const& temps, typename D, size_t I>
+    template <typename A, typename V, auto const& temps, width_t Base, typename D, size_t I>
     GAL_FORCE_INLINE static void finalize_temps(D& data, std::integral_constant<size_t, I>)
     {
         if constexpr (I == std::decay_t<decltype(temps)>::size())
@@ -262,65 +698,106 @@ namespace detail
         }
         else
         {
-            constexpr static auto ie = temps.template get<I>().ie;
-            constexpr static auto o  = temps.template get<I>().o;
+            constexpr static size_t count = std::decay_t<decltype(temps)>::size();
+            constexpr static size_t partner
+                = sincos_partner<temps, I>(std::make_index_sequence<count>{});
             constexpr static auto id = temps.template get<I>().id;
-            if constexpr (detail::uses_null_basis<A>)
+            constexpr static mv_op op = temps.template get<I>().ie.o;
+            if constexpr (is_closed_form_tail(op))
             {
-                constexpr static auto null_conversion = detail::to_null_basis(ie);
-                compute_temp<null_conversion, o, V, A>(
-                    data, std::make_index_sequence<null_conversion.size.term>{}, id);
+                // Evaluated with the first result of the closed form
             }
-            else
+            else if constexpr (is_closed_form(op))
+            {
+                using r = reified<A, temp_argument<temps, I>::value, Base>;
+                compute_products<V, r::hoisted, Base>(
+                    data, std::make_index_sequence<r::hoisted.count>{});
+                V const x = term_value<V, r::horner, 0>(data);
+                if constexpr (op == mv_op::exp_even)
+                {
+                    V even;
+                    V odd;
+                    V dual;
+                    exp_closed(x, even, odd, dual);
+                    data[id]     = even;
+                    data[id + 1] = odd;
+                    data[id + 2] = dual;
+                }
+                else
+                {
+                    V odd;
+                    V dual;
+                    log_closed(x, odd, dual);
+                    data[id]     = odd;
+                    data[id + 1] = dual;
+                }
+            }
+            else if constexpr (partner == count)
+            {
+                using r                 = reified<A, temp_ie<temps, I>::value, Base>;
+                constexpr static auto o = temps.template get<I>().o;
+                compute_products<V, r::hoisted, Base>(
+                    data, std::make_index_sequence<r::hoisted.count>{});
+                compute_temp<r::horner, o, V, A>(
+                    data, std::make_index_sequence<r::form.size.term>{}, id);
+            }
+            else if constexpr (partner > I)
             {
-                compute_temp<ie, o, V, A>(data, std::make_index_sequence<ie.size.term>(), id);
+                // Both temporaries are evaluated here as the argument is already available
+                using r = reified<A, temp_argument<temps, I>::value, Base>;
+                compute_products<V, r::hoisted, Base>(
+                    data, std::make_index_sequence<r::hoisted.count>{});
+                constexpr static bool is_sin = temps.template get<I>().ie.o == mv_op::sin;
+                constexpr static auto other  = temps.template get<partner>().id;
+                V s;
+                V c;
+                apply_sincos(term_value<V, r::horner, 0>(data), s, c);
+                data[is_sin ? id : other] = s;
+                data[is_sin ? other : id] = c;
             }
 
             if constexpr (I + 1 != std::decay_t<decltype(temps)>::size())
             {
-                finalize_temps<A, V, temps>(data, std::integral_constant<size_t, I + 1>{});
+                finalize_temps<A, V, temps, Base>(data, std::integral_constant<size_t, I + 1>{});
             }
         }
     }
 
-    template <typename A, typename V, auto const& result, typename D, num_t Num, den_t Den>
-    GAL_FORCE_INLINE static auto finalize_entity(D const& data,
+    template <typename A,
+              typename V,
+              auto const& result,
+              width_t Base,
+              typename D,
+              num_t Num,
+              den_t Den>
+    GAL_FORCE_INLINE static auto finalize_entity(D& data,
                                                  std::integral_constant<num_t, Num> n,
                                                  std::integral_constant<den_t, Den> d)
     {
-        if constexpr (detail::uses_null_basis<A>)
-        {
-            constexpr static auto null_conversion = detail::to_null_basis(result);
-            return compute_entity<null_conversion, V, A>(
-                data, n, d, std::make_index_sequence<null_conversion.size.term>());
-        }
-        else
-        {
-            return compute_entity<result, V, A>(
-                data, n, d, std::make_index_sequence<result.size.term>());
-        }
+        using r = reified<A, result, Base>;
+        compute_products<V, r::hoisted, Base>(data, std::make_index_sequence<r::hoisted.count>{});
+        return compute_entity<r::form, r::horner, V, A>(
+            data, n, d, std::make_index_sequence<r::form.size.term>());
     }
 
-    template <typename A, typename V, auto const& results, size_t I>
+    template <typename A, typename V, auto const& results, width_t Base, size_t I>
     struct result_finalizer
     {
-        constexpr static auto ie = results.template get<I>().second;
-
         template <typename D, num_t Num, den_t Den>
-        GAL_FORCE_INLINE constexpr static auto compute(D const& data,
+        GAL_FORCE_INLINE constexpr static auto compute(D& data,
                                                        std::integral_constant<num_t, Num> n,
                                                        std::integral_constant<den_t, Den> d) noexcept
         {
-            return finalize_entity<A, V, ie>(data, n, d);
+            return finalize_entity<A, V, result_ie<results, I>::value, Base>(data, n, d);
         }
     };
 
-    template <typename A, typename V, auto const& results>
+    template <typename A, typename V, auto const& results, width_t Base>
     struct finalize_entities
     {
         constexpr static size_t size = std::decay_t<decltype(results)>::size();
         template <typename D, num_t Num, den_t Den>
-        GAL_FORCE_INLINE constexpr static auto execute(D const& data,
+        GAL_FORCE_INLINE constexpr static auto execute(D& data,
                                                        std::integral_constant<num_t, Num> n,
                                                        std::integral_constant<den_t, Den> d) noexcept
         {
@@ -328,13 +805,13 @@ namespace detail
         }
 
         template <typename D, num_t Num, den_t Den, size_t... I>
-        GAL_FORCE_INLINE constexpr static auto execute_impl(D const& data,
+        GAL_FORCE_INLINE constexpr static auto execute_impl(D& data,
                                                             std::integral_constant<num_t, Num> n,
                                                             std::integral_constant<den_t, Den> d,
                                                             std::index_sequence<I...>) noexcept
         {
             return std::make_tuple(
-                result_finalizer<A, V, results, size - I - 1>::compute(data, n, d)...);
+                result_finalizer<A, V, results, Base, size - I - 1>::compute(data, n, d)...);
         }
     };
 
@@ -355,10 +832,43 @@ namespace detail
         using value_t = float;
     };
 
+    // Inputs to a batched computation are either spans (one element per lane) or entities which are
+    // broadcast to every lane.
+    template <typename D>
+    struct batch_element
+    {
+        using type = D;
+    };
+
+    template <typename D>
+    struct batch_element<span<D>>
+    {
+        using type = std::remove_cv_t<D>;
+    };
+
+    template <typename D>
+    struct batch_element<soa_span<D>>
+    {
+        using type = D;
+    };
+
+    template <typename D, size_t W>
+    struct batch_element<aosoa_span<D, W>>
+    {
+        using type = D;
+    };
+
+    // Batched inputs supply a distinct element per invocation (all other inputs are broadcast)
+    template <typename D>
+    constexpr inline bool is_batched_v = is_span_v<D> || is_soa_span_v<D> || aosoa_width_v<D> != 0;
+
+    template <typename D>
+    using batch_element_t = typename batch_element<D>::type;
+
     template <typename D>
     constexpr size_t data_size() noexcept
     {
-        if constexpr (std::is_floating_point_v<D>)
+        if constexpr (detail::is_field_v<D>)
         {
             return 1;
         }
@@ -368,43 +878,232 @@ namespace detail
         }
     }
 
-    template <typename A, typename... Data>
-    struct evaluate
-    {
-#ifdef GAL_DEBUG
-        // Produce the RPN expression
-        template <typename L>
-        [[nodiscard]] static auto rpnf(L lambda) noexcept
-        {
-            constexpr static auto entities   = detail::rpne_entities<A, Data...>();
-            constexpr static auto expression = std::apply(lambda, entities.first);
-            return detail::rpne_concat<expression>();
-        }
+    // Inputs may assert side relations among their components (see normalized)
+    template <typename D, typename = void>
+    struct has_relations : std::false_type
+    {};
 
-        template <typename L>
-        [[nodiscard]] static auto rpnf_debug(L lambda) noexcept
-        {
-            constexpr static auto entities = detail::rpne_entities<A, Data...>();
-            return std::apply(lambda, entities.first);
-        }
+    template <typename D>
+    struct has_relations<D, std::void_t<decltype(D::relations(0u))>> : std::true_type
+    {};
 
-        // Produce an RPN expression with CSEs factored out
-        template <typename L>
-        [[nodiscard]] static auto rpnf_reshaped(L lambda) noexcept
+    template <typename D>
+    constexpr mv_size relation_capacity() noexcept
+    {
+        if constexpr (has_relations<D>::value)
         {
-            constexpr static auto entities   = detail::rpne_entities<A, Data...>();
-            constexpr static auto expression = std::apply(lambda, entities.first);
-            return detail::rpn_reshape(detail::rpne_concat<expression>());
+            using R = decltype(D::relations(0u));
+            return {R::ind_capacity(), R::mon_capacity(), R::term_capacity()};
         }
-
-        template <typename L>
-        static auto input_map(L lambda) noexcept
+        else
         {
-            constexpr static auto entities   = detail::rpne_entities<A, Data...>();
-            constexpr static auto expression = std::apply(lambda, entities.first);
-            constexpr static auto rpn        = detail::rpne_concat<expression>();
-            constexpr static auto id_count   = detail::rpn_id_count(rpn);
-            return detail::rpn_ids(rpn, std::integral_constant<width_t, id_count>{});
+            return {};
+        }
+    }
+
+    // Gathers the side relations of all inputs, expressed in the identifiers of their components,
+    // into a single multivector holding one relation per term
+    template <typename A, typename... Data>
+    [[nodiscard]] constexpr auto input_relations() noexcept
+    {
+        mv<A,
+           (relation_capacity<Data>().ind + ... + 0),
+           (relation_capacity<Data>().mon + ... + 0),
+           (relation_capacity<Data>().term + ... + 0)>
+            out{};
+        uint32_t id = 0;
+
+        auto gather = [&](auto const* tag) {
+            using D = std::remove_cv_t<std::remove_pointer_t<decltype(tag)>>;
+            if constexpr (has_relations<D>::value)
+            {
+                auto relations = D::relations(id);
+                for (auto it = relations.cbegin(); it != relations.cend(); ++it)
+                {
+                    out.push(it, one, static_cast<elem_t>(out.size.term));
+                }
+            }
+            id += static_cast<uint32_t>(data_size<D>());
+        };
+        (gather(static_cast<Data const*>(nullptr)), ...);
+        return out;
+    }
+
+    // Temporaries whose terms merely scale another indeterminate (the reversion of an input, for
+    // example) are substituted into every later multivector before side relations are applied,
+    // as relations are expressed in the identifiers of the inputs
+    template <typename T, size_t... I>
+    [[nodiscard]] constexpr auto alias_capacity(std::index_sequence<I...>) noexcept
+    {
+        return (width_t{0} + ... + decltype(std::declval<T>().template get<I>().ie)::term_capacity());
+    }
+
+    template <typename T>
+    struct temp_aliases
+    {
+        std::array<ind_alias, alias_capacity<T>(std::make_index_sequence<T::size()>{})> aliases;
+        width_t count = 0;
+    };
+
+    // Rewrites the temporaries and results of a processed expression modulo the side relations of
+    // the inputs (see reduce_relations). Expressions without relations are left untouched.
+    template <auto const& relations, auto const& processed>
+    struct related
+    {
+        using temps_t = std::decay_t<decltype(processed.temps)>;
+        using args_t  = std::decay_t<decltype(processed.args)>;
+
+        template <size_t... I>
+        [[nodiscard]] constexpr static auto relate_temps(std::index_sequence<I...>) noexcept
+        {
+            temp_aliases<temps_t> table{};
+            if constexpr (sizeof...(I) == 0)
+            {
+                return pair{tuple{}, table};
+            }
+            else
+            {
+                auto relate = [&table](auto const& temp) {
+                    auto ie = reduce_relations<true>(
+                        substitute_aliases<true>(temp.ie, table.aliases, table.count), relations);
+                    if (ie.o == mv_op::id)
+                    {
+                        for (width_t t = 0; t != ie.size.term; ++t)
+                        {
+                            mon const& m = ie.mons[ie.terms[t].mon_offset];
+                            if (ie.terms[t].count == 1 && m.count == 1
+                                && ie.inds[m.ind_offset].degree == one)
+                            {
+                                table.aliases[table.count++]
+                                    = ind_alias{temp.id + t, ie.inds[m.ind_offset].id, m.q};
+                            }
+                        }
+                    }
+                    return rpn_temp{ie, temp.o, temp.checksum, temp.id};
+                };
+                // Temporaries only refer to those preceding them
+                auto temps = tuple{relate(processed.temps.template get<I>())...};
+                return pair{temps, table};
+            }
+        }
+
+        constexpr static auto temps_and_aliases
+            = relate_temps(std::make_index_sequence<temps_t::size()>{});
+
+        template <size_t... I>
+        [[nodiscard]] constexpr static auto relate_args(std::index_sequence<I...>) noexcept
+        {
+            constexpr auto const& table = temps_and_aliases.second;
+            return tuple{pair{processed.args.template get<I>().first,
+                              reduce_relations<false>(
+                                  substitute_aliases<false>(processed.args.template get<I>().second,
+                                                            table.aliases,
+                                                            table.count),
+                                  relations)}...};
+        }
+
+        constexpr static auto temps = temps_and_aliases.first;
+        constexpr static auto args  = relate_args(std::make_index_sequence<args_t::size()>{});
+    };
+
+    template <auto const& relations, auto const& processed>
+    [[nodiscard]] constexpr auto relate_temps() noexcept
+    {
+        if constexpr (std::decay_t<decltype(relations)>::term_capacity() == 0)
+        {
+            return processed.temps;
+        }
+        else
+        {
+            return related<relations, processed>::temps;
+        }
+    }
+
+    template <auto const& relations, auto const& processed>
+    [[nodiscard]] constexpr auto relate_args() noexcept
+    {
+        if constexpr (std::decay_t<decltype(relations)>::term_capacity() == 0)
+        {
+            return processed.args;
+        }
+        else
+        {
+            return related<relations, processed>::args;
+        }
+    }
+
+    template <typename A, typename... Data>
+    struct evaluate
+    {
+        // Counts the operations performed when the lambda is computed. For example,
+        //     auto cost = evaluate<point<>, motor<>>::cost(sandwich);
+        //     static_assert(decltype(cost)::value.mul <= 84);
+        template <typename L>
+        [[nodiscard]] static auto cost(L lambda) noexcept
+        {
+            // See compute
+            constexpr static auto entities   = detail::rpne_entities<A, Data...>();
+            constexpr static auto expression = std::apply(lambda, entities.first);
+            constexpr static auto rpn        = detail::rpne_concat<expression>();
+            constexpr static auto reshaped   = detail::rpn_reshape(rpn);
+            constexpr static auto id_count   = detail::rpn_id_count(reshaped);
+            constexpr static auto flattened
+                = detail::rpn_ids(reshaped, std::integral_constant<width_t, id_count>{});
+            constexpr static auto ids     = flattened.first;
+            constexpr static auto indices = flattened.second;
+            constexpr static auto inputs  = detail::rpn_inputs<A, ids, indices, Data...>{}(
+                std::make_index_sequence<ids.size()>{});
+            constexpr static detail::rpn_state input_state{
+                inputs, tuple<>{}, tuple<>{}, entities.second.first};
+            constexpr static auto const& processed
+                = detail::rpn_ctx<reshaped, 0, reshaped.count, input_state>::state;
+            constexpr static auto relations = detail::input_relations<A, Data...>();
+            constexpr static auto temps     = detail::relate_temps<relations, processed>();
+            constexpr static auto args      = detail::relate_args<relations, processed>();
+            constexpr static width_t base
+                = (detail::data_size<Data>() + ...) + processed.id_count - entities.second.first;
+
+            constexpr static op_count value = detail::count_ops<A, temps, args, base>(
+                reshaped.q,
+                std::make_index_sequence<std::decay_t<decltype(temps)>::size()>{},
+                std::make_index_sequence<decltype(processed.args)::size()>{});
+            return op_count_constant<value>{};
+        }
+
+#ifdef GAL_DEBUG
+        // Produce the RPN expression
+        template <typename L>
+        [[nodiscard]] static auto rpnf(L lambda) noexcept
+        {
+            constexpr static auto entities   = detail::rpne_entities<A, Data...>();
+            constexpr static auto expression = std::apply(lambda, entities.first);
+            return detail::rpne_concat<expression>();
+        }
+
+        template <typename L>
+        [[nodiscard]] static auto rpnf_debug(L lambda) noexcept
+        {
+            constexpr static auto entities = detail::rpne_entities<A, Data...>();
+            return std::apply(lambda, entities.first);
+        }
+
+        // Produce an RPN expression with CSEs factored out
+        template <typename L>
+        [[nodiscard]] static auto rpnf_reshaped(L lambda) noexcept
+        {
+            constexpr static auto entities   = detail::rpne_entities<A, Data...>();
+            constexpr static auto expression = std::apply(lambda, entities.first);
+            return detail::rpn_reshape(detail::rpne_concat<expression>());
+        }
+
+        template <typename L>
+        static auto input_map(L lambda) noexcept
+        {
+            constexpr static auto entities   = detail::rpne_entities<A, Data...>();
+            constexpr static auto expression = std::apply(lambda, entities.first);
+            constexpr static auto rpn        = detail::rpne_concat<expression>();
+            constexpr static auto id_count   = detail::rpn_id_count(rpn);
+            return detail::rpn_ids(rpn, std::integral_constant<width_t, id_count>{});
         }
 
         // Produce a multivector
@@ -483,15 +1182,23 @@ namespace detail
             inputs, tuple<>{}, tuple<>{}, entities.second.first};
         constexpr static auto const& processed
             = detail::rpn_ctx<reshaped, 0, reshaped.count, input_state>::state;
-        constexpr static auto temps = processed.temps;
+        constexpr static auto relations = detail::input_relations<A, Data...>();
+        constexpr static auto temps     = detail::relate_temps<relations, processed>();
+        constexpr static auto args      = detail::relate_args<relations, processed>();
 
-        // All temporaries need to be evaluated in order
+        // All temporaries need to be evaluated in order, followed by the products hoisted from
+        // whichever multivector is being evaluated
+        constexpr static width_t base
+            = (detail::data_size<Data>() + ...) + processed.id_count - entities.second.first;
         std::array<detail::ind_value<V>,
-                   ((detail::data_size<Data>() + ...) + processed.id_count - entities.second.first)>
+                   base
+                       + detail::hoisted_slots<A, temps, args, base>(
+                           std::make_index_sequence<std::decay_t<decltype(temps)>::size()>{},
+                           std::make_index_sequence<decltype(processed.args)::size()>{})>
             data{};
         detail::fill(data.data(), input...);
         // Evaluate temporaries which will be appended to the data array as value types
-        detail::finalize_temps<A, V, temps>(data, std::integral_constant<size_t, 0>{});
+        detail::finalize_temps<A, V, temps, base>(data, std::integral_constant<size_t, 0>{});
 
         if constexpr (decltype(processed.args)::size() == 0)
         {
@@ -499,9 +1206,7 @@ namespace detail
         }
         else if constexpr (decltype(processed.args)::size() == 1)
         {
-            constexpr static auto result_ie = processed.args.template get<0>().second;
-
-            return detail::finalize_entity<A, V, result_ie>(
+            return detail::finalize_entity<A, V, detail::result_ie<args, 0>::value, base>(
                 data,
                 std::integral_constant<num_t, scale_factor.num>{},
                 std::integral_constant<den_t, scale_factor.den>{});
@@ -509,12 +1214,894 @@ namespace detail
         else
         {
             // Pack each returned entity into a tuple
-            constexpr static auto args = processed.args;
-            return detail::finalize_entities<A, V, args>::execute(
+            return detail::finalize_entities<A, V, args, base>::execute(
                 data,
                 std::integral_constant<num_t, scale_factor.num>{},
                 std::integral_constant<den_t, scale_factor.den>{});
         }
     }
+
+    // Marks the terms of a temporary as bound if it only refers to bound indeterminates
+    template <size_t N, typename T>
+    constexpr void mark_bound(std::array<bool, N>& bound, T const& temp) noexcept
+    {
+        for (width_t i = 0; i != temp.ie.size.ind; ++i)
+        {
+            width_t id = temp.ie.inds[i].id;
+            if (id < ind_constant_start && !bound[id])
+            {
+                return;
+            }
+        }
+
+        for (width_t i = 0; i != temp.ie.size.term; ++i)
+        {
+            bound[temp.id + i] = true;
+        }
+    }
+
+    // Flags the identifiers below N that are known once the leading inputs are bound: the bound
+    // inputs themselves and every temporary computed from them alone
+    template <size_t N, typename T, size_t... I>
+    [[nodiscard]] constexpr auto
+    bound_ids(T const& temps, width_t bound_size, std::index_sequence<I...>) noexcept
+    {
+        std::array<bool, N> out{};
+        for (width_t i = 0; i != bound_size; ++i)
+        {
+            out[i] = true;
+        }
+        (mark_bound(out, temps.template get<I>()), ...);
+        return out;
+    }
+
+    template <typename C, typename K>
+    struct bound_split
+    {
+        C coefficients;
+        K kernel;
+    };
+
+    // Splits every monomial of a multivector into its bound and free indeterminates. Monomials of a
+    // term with the same free part are grouped, and the sum of their bound parts becomes a
+    // coefficient evaluated once when the inputs are bound. Coefficient k is returned as the term
+    // with element k of the first multivector, and the kernel refers to it as the indeterminate
+    // with identifier id + k (greater than any free identifier, so monomials remain sorted).
+    // Monomials which would produce a coefficient consisting of a single bound indeterminate are
+    // left as they are.
+    template <typename A, width_t I, width_t M, width_t T, size_t N>
+    [[nodiscard]] constexpr auto
+    split_bound(mv<A, I, M, T> const& in, std::array<bool, N> const& bound, width_t id) noexcept
+    {
+        auto is_bound = [&bound](ind const& x) {
+            return x.id >= ind_constant_start || bound[x.id];
+        };
+
+        auto same_free = [&in, &is_bound](mon const& lhs, mon const& rhs) {
+            width_t l     = lhs.ind_offset;
+            width_t l_end = lhs.ind_offset + lhs.count;
+            width_t r     = rhs.ind_offset;
+            width_t r_end = rhs.ind_offset + rhs.count;
+            while (true)
+            {
+                while (l != l_end && is_bound(in.inds[l]))
+                {
+                    ++l;
+                }
+                while (r != r_end && is_bound(in.inds[r]))
+                {
+                    ++r;
+                }
+                if (l == l_end || r == r_end)
+                {
+                    return l == l_end && r == r_end;
+                }
+                if (in.inds[l] != in.inds[r])
+                {
+                    return false;
+                }
+                ++l;
+                ++r;
+            }
+        };
+
+        mv<A, I, M, M> coefficients{};
+        mv<A, I + M, M, T> kernel{};
+        width_t coefficient_ind = 0;
+        width_t coefficient_mon = 0;
+        width_t coefficient     = 0;
+        width_t kernel_ind      = 0;
+        width_t kernel_mon      = 0;
+        std::array<bool, M> grouped{};
+
+        for (width_t t = 0; t != in.size.term; ++t)
+        {
+            term const& in_term = in.terms[t];
+            width_t mon_begin   = in_term.mon_offset;
+            width_t mon_end     = in_term.mon_offset + in_term.count;
+            width_t mon_offset  = kernel_mon;
+
+            for (width_t m = mon_begin; m != mon_end; ++m)
+            {
+                if (grouped[m])
+                {
+                    continue;
+                }
+
+                mon const& first = in.mons[m];
+                width_t members  = 0;
+                for (width_t n = m; n != mon_end; ++n)
+                {
+                    if (!grouped[n] && same_free(first, in.mons[n]))
+                    {
+                        ++members;
+                    }
+                }
+
+                width_t bound_count = 0;
+                rat bound_degree{0};
+                for (width_t i = first.ind_offset; i != first.ind_offset + first.count; ++i)
+                {
+                    if (is_bound(in.inds[i]))
+                    {
+                        ++bound_count;
+                        bound_degree = in.inds[i].degree;
+                    }
+                }
+
+                if (members == 1 && (bound_count == 0 || (bound_count == 1 && bound_degree == one)))
+                {
+                    grouped[m]                = true;
+                    kernel.mons[kernel_mon++] = mon{first.q, first.degree, first.count, kernel_ind};
+                    for (width_t i = first.ind_offset; i != first.ind_offset + first.count; ++i)
+                    {
+                        kernel.inds[kernel_ind++] = in.inds[i];
+                    }
+                    continue;
+                }
+
+                width_t coefficient_offset = coefficient_mon;
+                for (width_t n = m; n != mon_end; ++n)
+                {
+                    if (grouped[n] || !same_free(first, in.mons[n]))
+                    {
+                        continue;
+                    }
+
+                    grouped[n]         = true;
+                    mon const& member  = in.mons[n];
+                    width_t ind_offset = coefficient_ind;
+                    rat degree{0};
+                    for (width_t i = member.ind_offset; i != member.ind_offset + member.count; ++i)
+                    {
+                        if (is_bound(in.inds[i]))
+                        {
+                            coefficients.inds[coefficient_ind++] = in.inds[i];
+                            degree                               = degree + in.inds[i].degree;
+                        }
+                    }
+                    coefficients.mons[coefficient_mon++]
+                        = mon{member.q, degree, coefficient_ind - ind_offset, ind_offset};
+                }
+                coefficients.terms[coefficient]
+                    = term{coefficient_mon - coefficient_offset,
+                           coefficient_offset,
+                           static_cast<uint32_t>(coefficient)};
+
+                width_t ind_offset = kernel_ind;
+                rat degree{1};
+                for (width_t i = first.ind_offset; i != first.ind_offset + first.count; ++i)
+                {
+                    if (!is_bound(in.inds[i]))
+                    {
+                        kernel.inds[kernel_ind++] = in.inds[i];
+                        degree                    = degree + in.inds[i].degree;
+                    }
+                }
+                kernel.inds[kernel_ind++] = ind{id + coefficient, one};
+                kernel.mons[kernel_mon++] = mon{one, degree, kernel_ind - ind_offset, ind_offset};
+                ++coefficient;
+            }
+
+            kernel.terms[t] = term{kernel_mon - mon_offset, mon_offset, in_term.element};
+        }
+
+        coefficients.size = mv_size{coefficient_ind, coefficient_mon, coefficient};
+        kernel.size       = mv_size{kernel_ind, kernel_mon, in.size.term};
+
+        // Monomials are sorted within each term (see poincare_dual)
+        std::array<mon_view, M> coefficient_views;
+        for (width_t i = 0; i != coefficients.size.mon; ++i)
+        {
+            coefficient_views[i] = mon_view{coefficients.mons[i], coefficients.inds.begin()};
+        }
+        std::array<mon_view, M> kernel_views;
+        for (width_t i = 0; i != kernel.size.mon; ++i)
+        {
+            kernel_views[i] = mon_view{kernel.mons[i], kernel.inds.begin()};
+        }
+
+        bound_split<mv<A, I, M, M>, mv<A, I + M, M, T>> out{};
+        collate(coefficients.terms.begin(),
+                coefficients.terms.begin() + coefficients.size.term,
+                coefficient_views.begin(),
+                coefficients.inds.begin(),
+                out.coefficients.terms.begin(),
+                out.coefficients.mons.begin(),
+                out.coefficients.inds.begin(),
+                out.coefficients.size);
+        collate(kernel.terms.begin(),
+                kernel.terms.begin() + kernel.size.term,
+                kernel_views.begin(),
+                kernel.inds.begin(),
+                out.kernel.terms.begin(),
+                out.kernel.mons.begin(),
+                out.kernel.inds.begin(),
+                out.kernel.size);
+        return out;
+    }
+
+    // The reduced expression of a bound kernel. Data holds the bound inputs followed by the free
+    // inputs, and the first BoundSize identifiers refer to the bound inputs.
+    template <typename A, auto const& rpn, width_t BoundSize, typename... Data>
+    struct bind_plan
+    {
+        // See compute
+        constexpr static auto entities    = rpne_entities<A, Data...>();
+        constexpr static auto reshaped    = rpn_reshape(rpn);
+        constexpr static rat scale_factor = reshaped.q;
+
+        constexpr static auto id_count = rpn_id_count(reshaped);
+        constexpr static auto flattened
+            = rpn_ids(reshaped, std::integral_constant<width_t, id_count>{});
+        constexpr static auto ids     = flattened.first;
+        constexpr static auto indices = flattened.second;
+        constexpr static auto inputs
+            = rpn_inputs<A, ids, indices, Data...>{}(std::make_index_sequence<ids.size()>{});
+
+        constexpr static rpn_state input_state{inputs, tuple<>{}, tuple<>{}, entities.second.first};
+        constexpr static auto const& processed
+            = rpn_ctx<reshaped, 0, reshaped.count, input_state>::state;
+        constexpr static auto relations = detail::input_relations<A, Data...>();
+        constexpr static auto temps     = detail::relate_temps<relations, processed>();
+        constexpr static auto args      = detail::relate_args<relations, processed>();
+
+        constexpr static size_t temp_count = std::decay_t<decltype(temps)>::size();
+        constexpr static size_t arg_count  = decltype(processed.args)::size();
+        constexpr static width_t base
+            = (data_size<Data>() + ...) + processed.id_count - entities.second.first;
+
+        constexpr static auto bound
+            = bound_ids<base>(temps, BoundSize, std::make_index_sequence<temp_count>{});
+    };
+
+    // Temporaries precede the results
+    template <typename Plan, size_t J>
+    [[nodiscard]] constexpr auto bound_ie() noexcept
+    {
+        if constexpr (J < Plan::temp_count)
+        {
+            return Plan::temps.template get<J>().ie;
+        }
+        else
+        {
+            return Plan::args.template get<J - Plan::temp_count>().second;
+        }
+    }
+
+    template <typename Plan, size_t J>
+    struct bound_shape
+    {
+        constexpr static auto ie = bound_ie<Plan, J>();
+
+        [[nodiscard]] constexpr static bool only_bound() noexcept
+        {
+            for (width_t i = 0; i != ie.size.ind; ++i)
+            {
+                width_t id = ie.inds[i].id;
+                if (id < ind_constant_start && !Plan::bound[id])
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        // Temporaries of bound indeterminates alone are evaluated when the inputs are bound. Sums
+        // of monomials can only be regrouped if no operation is applied to each monomial.
+        constexpr static bool is_bound = J < Plan::temp_count && only_bound();
+        constexpr static bool is_split = !is_bound && ie.o == mv_op::id;
+        constexpr static width_t coefficient_count
+            = is_split ? split_bound(ie, Plan::bound, 0).coefficients.size.term : 0;
+    };
+
+    template <typename Plan, size_t... J>
+    [[nodiscard]] constexpr width_t coefficient_total(std::index_sequence<J...>) noexcept
+    {
+        return (bound_shape<Plan, J>::coefficient_count + ... + 0);
+    }
+
+    template <typename Plan, size_t J>
+    struct bound_form
+    {
+        using shape = bound_shape<Plan, J>;
+
+        // Coefficients follow the temporaries in the data array
+        constexpr static width_t coefficient_id
+            = Plan::base + coefficient_total<Plan>(std::make_index_sequence<J>{});
+
+        [[nodiscard]] constexpr static auto split() noexcept
+        {
+            if constexpr (shape::is_split)
+            {
+                constexpr auto out = split_bound(shape::ie, Plan::bound, coefficient_id);
+                constexpr auto coefficients = out.coefficients.template resize<
+                    out.coefficients.size.ind,
+                    out.coefficients.size.mon,
+                    out.coefficients.size.term>();
+                constexpr auto kernel = out.kernel.template resize<out.kernel.size.ind,
+                                                                   out.kernel.size.mon,
+                                                                   out.kernel.size.term>();
+                return bound_split<std::decay_t<decltype(coefficients)>,
+                                   std::decay_t<decltype(kernel)>>{coefficients, kernel};
+            }
+            else
+            {
+                using ie_t = std::decay_t<decltype(shape::ie)>;
+                return bound_split<ie_t, ie_t>{ie_t{}, shape::ie};
+            }
+        }
+
+        constexpr static auto form         = split();
+        constexpr static auto coefficients = form.coefficients;
+        constexpr static auto kernel       = form.kernel;
+    };
+
+    template <typename Plan>
+    struct bind_layout
+    {
+        constexpr static size_t count = Plan::temp_count + Plan::arg_count;
+        constexpr static width_t coefficient_count
+            = coefficient_total<Plan>(std::make_index_sequence<count>{});
+
+        // Products hoisted while binding or evaluating follow the coefficients
+        constexpr static width_t hoist_base = Plan::base + coefficient_count;
+
+        template <typename A, size_t... J>
+        [[nodiscard]] constexpr static width_t slots(std::index_sequence<J...>) noexcept
+        {
+            width_t out = 0;
+            ((out = std::max(
+                  {out,
+                   reified<A, bound_form<Plan, J>::coefficients, hoist_base, false>::hoisted.count,
+                   reified<A, bound_form<Plan, J>::kernel, hoist_base>::hoisted.count})),
+             ...);
+            return out;
+        }
+    };
+
+    // Evaluates whatever part of multivector J depends only on the bound inputs
+    template <typename A, typename V, typename Plan, width_t Base, size_t J, typename D>
+    static void bind_mv(D& data)
+    {
+        using shape = bound_shape<Plan, J>;
+        using form  = bound_form<Plan, J>;
+        if constexpr (shape::is_bound)
+        {
+            using r = reified<A, form::kernel, Base>;
+            compute_products<V, r::hoisted, Base>(data,
+                                                  std::make_index_sequence<r::hoisted.count>{});
+            compute_temp<r::horner, mv_op::id, V, A>(
+                data,
+                std::make_index_sequence<r::form.size.term>{},
+                Plan::temps.template get<J>().id);
+        }
+        else if constexpr (shape::is_split)
+        {
+            using r = reified<A, form::coefficients, Base, false>;
+            static_assert(r::form.size.term == shape::coefficient_count,
+                          "Every coefficient is stored in its own slot");
+            compute_products<V, r::hoisted, Base>(data,
+                                                  std::make_index_sequence<r::hoisted.count>{});
+            compute_temp<r::horner, mv_op::id, V, A>(
+                data, std::make_index_sequence<r::form.size.term>{}, form::coefficient_id);
+        }
+    }
+
+    // Evaluates the temporary J when the kernel is invoked (unless it was bound)
+    template <typename A, typename V, typename Plan, width_t Base, size_t J, typename D>
+    GAL_FORCE_INLINE static void finalize_bound_temp(D& data)
+    {
+        if constexpr (!bound_shape<Plan, J>::is_bound)
+        {
+            using r = reified<A, bound_form<Plan, J>::kernel, Base>;
+            compute_products<V, r::hoisted, Base>(data,
+                                                  std::make_index_sequence<r::hoisted.count>{});
+            compute_temp<r::horner, mv_op::id, V, A>(
+                data,
+                std::make_index_sequence<r::form.size.term>{},
+                Plan::temps.template get<J>().id);
+        }
+    }
+
+    // A computation with its leading inputs bound (see bind)
+    template <typename A, auto const& rpn, width_t BoundSize, typename... Data>
+    class bound_kernel
+    {
+        using plan   = bind_plan<A, rpn, BoundSize, Data...>;
+        using layout = bind_layout<plan>;
+
+    public:
+        using value_t = typename infer_field<Data...>::value_t;
+
+        template <typename... Bound>
+        explicit bound_kernel(Bound const&... bound) noexcept
+        {
+            static_assert((data_size<Bound>() + ...) == BoundSize,
+                          "The bound inputs must match those supplied to bind");
+            std::array<ind_value<value_t>, layout::hoist_base + slots> data{};
+            fill(data.data(), bound...);
+            bind_all(data, std::make_index_sequence<layout::count>{});
+            for (width_t i = 0; i != layout::hoist_base; ++i)
+            {
+                values_[i] = *data[i];
+            }
+        }
+
+        // Evaluates the computation for the free inputs, supplied in the order in which they
+        // follow the bound inputs in the lambda
+        template <typename... Free>
+        [[nodiscard]] GAL_FORCE_INLINE auto operator()(Free const&... free) const noexcept
+        {
+            static_assert(sizeof...(Free) > 0, "Bound kernels are invoked with the free inputs");
+            static_assert(BoundSize + (data_size<Free>() + ...) == (data_size<Data>() + ...),
+                          "The free inputs must match those supplied to bind");
+
+            std::array<ind_value<value_t>, layout::hoist_base + slots> data;
+            for (width_t i = 0; i != layout::hoist_base; ++i)
+            {
+                data[i].is_pointer = true;
+                data[i].pointer    = &values_[i];
+            }
+            fill(data.data() + BoundSize, free...);
+            finalize_temps(data, std::make_index_sequence<plan::temp_count>{});
+
+            constexpr static rat scale_factor = plan::scale_factor;
+            if constexpr (plan::arg_count == 0)
+            {
+                return entity<A, value_t>{};
+            }
+            else if constexpr (plan::arg_count == 1)
+            {
+                return finalize_result<plan::temp_count>(
+                    data,
+                    std::integral_constant<num_t, scale_factor.num>{},
+                    std::integral_constant<den_t, scale_factor.den>{});
+            }
+            else
+            {
+                return finalize_results(data,
+                                        std::integral_constant<num_t, scale_factor.num>{},
+                                        std::integral_constant<den_t, scale_factor.den>{},
+                                        std::make_index_sequence<plan::arg_count>{});
+            }
+        }
+
+        // Number of bound values stored by the kernel (bound inputs, temporaries and coefficients)
+        [[nodiscard]] constexpr static size_t size() noexcept
+        {
+            return layout::hoist_base;
+        }
+
+    private:
+        constexpr static width_t slots
+            = layout::template slots<A>(std::make_index_sequence<layout::count>{});
+
+        template <typename D, size_t... J>
+        static void bind_all(D& data, std::index_sequence<J...>) noexcept
+        {
+            (bind_mv<A, value_t, plan, layout::hoist_base, J>(data), ...);
+        }
+
+        template <typename D, size_t... J>
+        GAL_FORCE_INLINE static void finalize_temps(D& data, std::index_sequence<J...>) noexcept
+        {
+            (finalize_bound_temp<A, value_t, plan, layout::hoist_base, J>(data), ...);
+        }
+
+        template <size_t J, typename D, num_t Num, den_t Den>
+        GAL_FORCE_INLINE static auto finalize_result(D& data,
+                                                     std::integral_constant<num_t, Num> n,
+                                                     std::integral_constant<den_t, Den> d) noexcept
+        {
+            return finalize_entity<A, value_t, bound_form<plan, J>::kernel, layout::hoist_base>(
+                data, n, d);
+        }
+
+        // Results are packed into a tuple in the order of compute (see finalize_entities)
+        template <typename D, num_t Num, den_t Den, size_t... I>
+        GAL_FORCE_INLINE static auto finalize_results(D& data,
+                                                      std::integral_constant<num_t, Num> n,
+                                                      std::integral_constant<den_t, Den> d,
+                                                      std::index_sequence<I...>) noexcept
+        {
+            return std::make_tuple(
+                finalize_result<plan::temp_count + plan::arg_count - I - 1>(data, n, d)...);
+        }
+
+        std::array<value_t, layout::hoist_base> values_;
+    };
+
+    // Binds the leading inputs of a computation. Every monomial is split into the part that depends
+    // only on bound inputs and the part that depends on the free inputs (named by type as they are
+    // not yet available), and the bound parts sharing a free part are summed into a coefficient
+    // evaluated here, once. The returned kernel only performs the work that depends on the free
+    // inputs, so that for example
+    //     auto k = bind<A, point<>>([](auto m, auto p) { return m * p * ~m; }, m);
+    // applies the motor m to a point as an affine map.
+    template <typename A, typename... Free, typename L, typename... Bound>
+    [[nodiscard]] static auto bind(L lambda, Bound const&... bound) noexcept
+    {
+        static_assert(sizeof...(Bound) > 0, "At least one input must be bound");
+        static_assert(sizeof...(Free) > 0, "Fully bound computations should use compute instead");
+
+        // See compute
+        constexpr static auto entities   = detail::rpne_entities<A, Bound..., Free...>();
+        constexpr static auto expression = std::apply(lambda, entities.first);
+        constexpr static auto rpn        = detail::rpne_concat<expression>();
+        return bound_kernel<A, rpn, (data_size<Bound>() + ...), Bound..., Free...>{bound...};
+    }
+
+    // Number of elements evaluated together as SIMD lanes by batched computations. If the output or
+    // any input is stored as AoSoA blocks, the block width is used instead.
+    template <typename T>
+    constexpr inline size_t batch_width = 32 / sizeof(T);
+
+    template <typename E, size_t W>
+    using lane_t = std::conditional_t<is_field_v<E>, simd<E, W>, aosoa_block<E, W>>;
+
+    template <typename R>
+    struct lane_element
+    {
+        static_assert(sizeof(R) == 0, "Batched computations must produce exactly one result");
+    };
+
+    template <typename A, typename T, elem_t... E>
+    struct lane_element<entity<A, T, E...>>
+    {
+        using type = entity<A, scalar_t<T>, E...>;
+    };
+
+    // Rebinds the value type of an output entity so a result can be converted to the output type
+    // over all lanes at once (vectorizing conversions such as homogenization)
+    template <typename O, typename U>
+    struct rebind_value
+    {
+        using type = void;
+    };
+
+    template <template <typename> class O, typename T, typename U>
+    struct rebind_value<O<T>, U>
+    {
+        using type = O<U>;
+    };
+
+    template <typename A, typename T, elem_t... E, typename U>
+    struct rebind_value<entity<A, T, E...>, U>
+    {
+        using type = entity<A, U, E...>;
+    };
+
+    template <typename L, typename D>
+    GAL_FORCE_INLINE static void broadcast_lanes(L& lanes, D const& datum) noexcept
+    {
+        if constexpr (is_batched_v<D>)
+        {
+            return;
+        }
+        else if constexpr (is_field_v<D>)
+        {
+            lanes = L{datum};
+        }
+        else
+        {
+            for (size_t i = 0; i != D::size(); ++i)
+            {
+                lanes[i] = datum[i];
+            }
+        }
+    }
+
+    template <size_t W, typename L, typename D, typename C>
+    GAL_FORCE_INLINE static void
+    gather_lanes(L& lanes, D const& datum, size_t first, C count) noexcept
+    {
+        using E = batch_element_t<D>;
+        // Lanes past the end of the input replicate the last element so padding never produces
+        // values that could trap or slow down evaluation (NaNs, denormals)
+        constexpr bool full = std::is_same_v<C, std::integral_constant<size_t, W>>;
+
+        if constexpr (!is_batched_v<D>)
+        {
+            // Broadcast inputs are written once for all blocks
+            return;
+        }
+        else if constexpr (aosoa_width_v<D> != 0)
+        {
+            // Full blocks are consumed in place (see lane_input), only the final block is copied
+            if constexpr (!full)
+            {
+                lanes = datum.blocks()[first / W];
+                for (size_t i = 0; i != E::size(); ++i)
+                {
+                    for (size_t w = count; w != W; ++w)
+                    {
+                        lanes[i][w] = lanes[i][count - 1];
+                    }
+                }
+            }
+        }
+        else if constexpr (is_soa_span_v<D>)
+        {
+            // Each component row is contiguous
+            for (size_t i = 0; i != E::size(); ++i)
+            {
+                auto const* row = datum.row(i) + first;
+                for (size_t w = 0; w != W; ++w)
+                {
+                    lanes[i][w] = row[full || w < count ? w : count - 1];
+                }
+            }
+        }
+        else
+        {
+            for (size_t w = 0; w != W; ++w)
+            {
+                size_t index = first + w;
+                if constexpr (!full)
+                {
+                    index = w < count ? index : first + count - 1;
+                }
+
+                if constexpr (is_field_v<E>)
+                {
+                    lanes[w] = datum[index];
+                }
+                else
+                {
+                    for (size_t i = 0; i != E::size(); ++i)
+                    {
+                        lanes[i][w] = datum[index][i];
+                    }
+                }
+            }
+        }
+    }
+
+    // Returns the lanes to evaluate for an input: full AoSoA blocks are referenced directly
+    template <size_t W, typename L, typename D, typename C>
+    GAL_FORCE_INLINE static auto const&
+    lane_input(L const& lanes, D const& datum, size_t first, C) noexcept
+    {
+        if constexpr (aosoa_width_v<D> != 0 && std::is_same_v<C, std::integral_constant<size_t, W>>)
+        {
+            return datum.blocks()[first / W];
+        }
+        else
+        {
+            return lanes;
+        }
+    }
+
+    // Writes the lanes of a result with the component layout of the output entity to a SoA or AoSoA
+    // output
+    template <size_t W, typename R, typename Out, typename C>
+    GAL_FORCE_INLINE static void
+    store_lanes(R const& result, Out const& out, size_t first, C count) noexcept
+    {
+        if constexpr (aosoa_width_v<Out> != 0)
+        {
+            // Padding lanes of the final block are overwritten
+            auto& block = out.blocks()[first / W];
+            for (size_t i = 0; i != R::size(); ++i)
+            {
+                block[i] = result[i];
+            }
+        }
+        else
+        {
+            for (size_t i = 0; i != R::size(); ++i)
+            {
+                auto* row = out.row(i) + first;
+                for (size_t w = 0; w != count; ++w)
+                {
+                    row[w] = result[i][w];
+                }
+            }
+        }
+    }
+
+    template <size_t W, typename R, typename Out, typename C>
+    GAL_FORCE_INLINE static void
+    scatter_lanes(R const& result, Out const& out, size_t first, C count) noexcept
+    {
+        using O         = batch_element_t<Out>;
+        using element_t = typename lane_element<R>::type;
+
+        if constexpr (is_span_v<Out>)
+        {
+            for (size_t w = 0; w != count; ++w)
+            {
+                element_t element;
+                for (size_t i = 0; i != R::size(); ++i)
+                {
+                    element[i] = result[i][w];
+                }
+                out[first + w] = element;
+            }
+        }
+        else if constexpr (std::is_same_v<O, element_t>)
+        {
+            detail::store_lanes<W>(result, out, first, count);
+        }
+        else
+        {
+            // Convert to the output entity over all lanes at once so conversions are vectorized
+            using rebound = typename rebind_value<O, typename R::value_t>::type;
+            static_assert(!std::is_void_v<rebound>,
+                          "SoA and AoSoA outputs must be entities templated on their value type");
+            rebound converted(result);
+            detail::store_lanes<W>(converted, out, first, count);
+        }
+    }
+
+    template <typename A, size_t W, typename L, typename Out, size_t... I, typename... Data>
+    GAL_FORCE_INLINE static void compute_batch(
+        L lambda, Out const& out, std::index_sequence<I...>, Data const&... input) noexcept
+    {
+        std::tuple<lane_t<batch_element_t<Data>, W>...> lanes{};
+        (detail::broadcast_lanes(std::get<I>(lanes), input), ...);
+
+        auto evaluate_block = [&](size_t first, auto count) {
+            (detail::gather_lanes<W>(std::get<I>(lanes), input, first, count), ...);
+            auto result = detail::compute<A>(
+                lambda, detail::lane_input<W>(std::get<I>(lanes), input, first, count)...);
+            detail::scatter_lanes<W>(result, out, first, count);
+        };
+
+        // Full blocks are evaluated with a constant lane count, followed by the remainder
+        size_t const tail = out.size() % W;
+        for (size_t first = 0; first != out.size() - tail; first += W)
+        {
+            evaluate_block(first, std::integral_constant<size_t, W>{});
+        }
+        if (tail != 0)
+        {
+            evaluate_block(out.size() - tail, tail);
+        }
+    }
+
+    // Selects the lane count of a batched computation: the width of the first AoSoA view involved
+    // (all AoSoA views must agree since their blocks are consumed whole), or batch_width<V>
+    template <typename V, typename... Data>
+    constexpr size_t select_batch_width() noexcept
+    {
+        size_t width = 0;
+        ((width = width == 0 ? aosoa_width_v<Data> : width), ...);
+        return width == 0 ? batch_width<V> : width;
+    }
+
+    // Evaluates a lambda once per element of the output view. Every input is either a view (one
+    // element per invocation) or an entity broadcast to all invocations. Elements are packed into
+    // SIMD lanes in structure-of-arrays form, so the expression is compiled once for the lane type
+    // and each evaluation processes batch_width<T> elements with vector arithmetic. All input views
+    // must hold at least as many elements as the output view.
+    //
+    // Views may be spans of entities (transposed to lanes on the fly), soa_span (component rows
+    // loaded directly) or aosoa_span (blocks consumed as is, avoiding any transposition).
+    template <typename A, typename L, typename Out, typename... Data>
+    static void compute_batch(L lambda, Out const& out, Data const&... input) noexcept
+    {
+        static_assert(sizeof...(Data) > 0, "Compute contexts without any inputs are not permitted");
+        static_assert((is_batched_v<Data> || ...), "At least one batched input must be a view");
+        static_assert(is_batched_v<Out>, "Batched outputs must be a span, soa_span or aosoa_span");
+
+        using V = scalar_t<typename detail::infer_field<batch_element_t<Data>...>::value_t>;
+        constexpr size_t W = select_batch_width<V, Out, Data...>();
+        static_assert(((aosoa_width_v<Data> == 0 || aosoa_width_v<Data> == W) && ...)
+                          && (aosoa_width_v<Out> == 0 || aosoa_width_v<Out> == W),
+                      "All AoSoA views of a batched computation must share the same block width");
+
+        detail::compute_batch<A, W>(lambda, out, std::index_sequence_for<Data...>{}, input...);
+    }
+
+    // Batched form of a conversion out of the algebra (for example, motors to matrices). The
+    // conversion is invoked with W input elements packed into an aosoa_block, so any compute it
+    // performs is evaluated over SIMD lanes, and must return an indexable result with simd entries
+    // which is scattered to the output span. Unlike compute_batch, the output need not be an entity.
+    template <typename F, typename O, typename I>
+    static void convert_batch(F convert, span<O> out, span<I> in) noexcept
+    {
+        using E            = std::remove_cv_t<I>;
+        constexpr size_t W = batch_width<scalar_t<typename E::value_t>>;
+
+        aosoa_block<E, W> lanes;
+        auto evaluate_block = [&](size_t first, auto count) {
+            detail::gather_lanes<W>(lanes, in, first, count);
+            auto result = convert(static_cast<aosoa_block<E, W> const&>(lanes));
+            for (size_t w = 0; w != count; ++w)
+            {
+                O& element = out[first + w];
+                for (size_t i = 0; i != O::size(); ++i)
+                {
+                    element[i] = result[i][w];
+                }
+            }
+        };
+
+        size_t const tail = out.size() % W;
+        for (size_t first = 0; first != out.size() - tail; first += W)
+        {
+            evaluate_block(first, std::integral_constant<size_t, W>{});
+        }
+        if (tail != 0)
+        {
+            evaluate_block(out.size() - tail, tail);
+        }
+    }
+
+    template <typename D>
+    GAL_FORCE_INLINE static auto slice_batch(D const& datum, size_t offset, size_t count) noexcept
+    {
+        if constexpr (is_batched_v<D>)
+        {
+            return datum.subspan(offset, count);
+        }
+        else
+        {
+            return datum;
+        }
+    }
+
+    // Invokes task(first, count) for consecutive chunks of [0, size) on an executor (see
+    // parallel_compute). Chunks are a multiple of grain elements (save the last), and several are
+    // formed per thread to leave room to rebalance uneven progress through stealing.
+    template <typename X, typename F>
+    static void parallel_chunks(X& executor, size_t size, size_t grain, F const& task)
+    {
+        size_t const chunks = executor.concurrency() * 8;
+        size_t const target = (size + chunks - 1) / chunks;
+        size_t const chunk  = std::max<size_t>((target + grain - 1) / grain * grain, grain);
+
+        executor.parallel_for((size + chunk - 1) / chunk, [&](size_t index) {
+            size_t const first = index * chunk;
+            task(first, std::min(chunk, size - first));
+        });
+    }
+
+    // Splits a batched computation into chunks evaluated by an executor (for example,
+    // gal::thread_pool). An executor exposes concurrency() and parallel_for(count, task), invoking
+    // task(i) for each chunk i in [0, count) and returning once all chunks have completed.
+    //
+    // Chunks are a multiple of both the batch width and 64 elements, so no SIMD block straddles two
+    // chunks and (provided the output storage is cache-line aligned) no two threads write to the
+    // same cache line of the output. The expression is compiled once and shared by every chunk.
+    template <typename A, typename X, typename L, typename Out, typename... Data>
+    static void parallel_compute(X& executor, L lambda, Out const& out, Data const&... input)
+    {
+        static_assert(sizeof...(Data) > 0, "Compute contexts without any inputs are not permitted");
+        static_assert((is_batched_v<Data> || ...), "At least one batched input must be a view");
+        static_assert(is_batched_v<Out>, "Batched outputs must be a span, soa_span or aosoa_span");
+
+        using V                = scalar_t<typename infer_field<batch_element_t<Data>...>::value_t>;
+        constexpr size_t W     = select_batch_width<V, Out, Data...>();
+        constexpr size_t grain = (64 + W - 1) / W * W;
+
+        parallel_chunks(executor, out.size(), grain, [&](size_t first, size_t count) {
+            detail::compute_batch<A>(lambda,
+                                     detail::slice_batch(out, first, count),
+                                     detail::slice_batch(input, first, count)...);
+        });
+    }
 } // namespace detail
 } // namespace gal
@@ -229,6 +229,47 @@ struct scalar
     T value;
 };
 
+// Wraps an entity E which the caller guarantees to be normalized (e * ~e = 1, as for unit rotors
+// and motors). Supplying the wrapped entity as an input is equivalent to supplying E, except that
+// the components of e * ~e - 1 are passed to the engine as side relations (see reduce_relations),
+// so the expanded polynomials are rewritten with identities such as s^2 + |B|^2 = 1 wherever the
+// evaluated expression shrinks. Results are unspecified if the entity is not in fact normalized.
+template <typename E>
+struct normalized
+{
+    using algebra_t = typename E::algebra_t;
+    using value_t   = typename E::value_t;
+
+    E value;
+
+    GAL_NODISCARD constexpr static auto ie(uint32_t id) noexcept
+    {
+        return E::ie(id);
+    }
+
+    GAL_NODISCARD constexpr static auto relations(uint32_t id) noexcept
+    {
+        auto ie = E::ie(id);
+        return detail::shift(minus_one,
+                             detail::product(typename algebra_t::geometric{}, ie, detail::reverse(ie)));
+    }
+
+    GAL_NODISCARD constexpr static size_t size() noexcept
+    {
+        return E::size();
+    }
+
+    GAL_NODISCARD constexpr value_t const& operator[](size_t index) const noexcept
+    {
+        return value[index];
+    }
+
+    GAL_NODISCARD constexpr value_t& operator[](size_t index) noexcept
+    {
+        return value[index];
+    }
+};
+
 namespace detail
 {
     template <typename T>
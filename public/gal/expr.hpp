@@ -53,6 +53,11 @@ namespace detail
         op_sin,  // (15) Sine
         op_cos,  // (16) Cosine
         op_tan,  // (17) Tangent
+        op_sign, // (18) Sign (1 or -1, following the sign bit)
+
+        // Closed forms (these ops are reified into multivectors over temporaries of their own)
+        op_exp, // (19) Exponential of a bivector
+        op_log, // (20) Logarithm of a normalized element of the even subalgebra
 
         // Constants
         c_zero = 1 << 16, // multivector that is exactly zero
@@ -78,201 +83,206 @@ namespace detail
         return false;
     }
 
-    // RPN node
-    struct node
+    inline namespace GAL_RATIONAL_ABI
     {
-        uint32_t o = 0;
-
-        // For an expression reference, the checksum is used as a placeholder to skip to a
-        // subsequent node in the expression.
-        crc_t checksum = 0;
-
-        // Ex is an overloaded member variable (unions are not modifiable in a constexpr context)
-        //
-        // For op summands, the ex corresponds to the number of nodes contained in the summand (not
-        // including this one).
-        //
-        // For exterior product factors, ex holds the number of operands (useful for computing the
-        // merge parity).
-        //
-        // For the sum and exterior operators, ex refers to the number of arguments.
-        //
-        // For the id op (used for an input with an identifier), ex is the index of the input in the
-        // input list.
-        //
-        // For extractions, ex refers to the element we wish to extract.
-        //
-        // For subexpression references (during DFA), ex is an index to the subexpression.
-        width_t ex = 0;
-
-        // This rational scaling constant can be used for sum subexpressions. If this is zero for a
-        // subexpression, the subexpression is part of an exterior product.
-        //
-        // For sum and exterior product nodes, the denominator here contains the total length of the
-        // expression that constitutes the subexpression up to and including the op_sum/op_ep.
-        rat q{0, 0};
-
-        constexpr bool operator==(node const& other) const
-        {
-            return o == other.o && checksum == other.checksum && ex == other.ex;
-        }
-
-        constexpr bool operator!=(node const& other) const
+        // RPN node
+        struct node
         {
-            return !(*this == other);
-        }
-    };
-
-    // Reverse-Polish notation expression
-    // A := Algebra which defines dimensionality, metric tensor, product evaluation functions
-    // S := Size
-    template <typename A, width_t S>
-    struct rpne
-    {
-        using algebra_t                   = A;
-        constexpr static width_t capacity = S;
+            uint32_t o = 0;
+
+            // For an expression reference, the checksum is used as a placeholder to skip to a
+            // subsequent node in the expression.
+            crc_t checksum = 0;
+
+            // Ex is an overloaded member variable (unions are not modifiable in a constexpr
+            // context)
+            //
+            // For op summands, the ex corresponds to the number of nodes contained in the summand
+            // (not including this one).
+            //
+            // For exterior product factors, ex holds the number of operands (useful for computing
+            // the merge parity).
+            //
+            // For the sum and exterior operators, ex refers to the number of arguments.
+            //
+            // For the id op (used for an input with an identifier), ex is the index of the input in
+            // the input list.
+            //
+            // For extractions, ex refers to the element we wish to extract.
+            //
+            // For subexpression references (during DFA), ex is an index to the subexpression.
+            width_t ex = 0;
+
+            // This rational scaling constant can be used for sum subexpressions. If this is zero
+            // for a subexpression, the subexpression is part of an exterior product.
+            //
+            // For sum and exterior product nodes, the denominator here contains the total length of
+            // the expression that constitutes the subexpression up to and including the
+            // op_sum/op_ep.
+            rat q{0, 0};
+
+            constexpr bool operator==(node const& other) const
+            {
+                return o == other.o && checksum == other.checksum && ex == other.ex;
+            }
 
-        // To simplify processing, we arrange this structure so that each node maps to exactly one
-        // factor
-        node nodes[S];
-        // The count here can easily diverge from the capacity due to CSE and term elimination
-        width_t count = 0;
-        rat q{1, 1};
+            constexpr bool operator!=(node const& other) const
+            {
+                return !(*this == other);
+            }
+        };
 
-        constexpr auto operator[](elem_t e) noexcept
+        // Reverse-Polish notation expression
+        // A := Algebra which defines dimensionality, metric tensor, product evaluation functions
+        // S := Size
+        template <typename A, width_t S>
+        struct rpne
         {
-            rpne<A, S + 1> out;
-            out.append(*this);
-            // Using operator[] successfully is not expected behavior, so we don't bother computing
-            // the checksum in a fancy manner.
-            out.nodes[out.count++] = node{op_comp, back().checksum + e, e};
-            out.q                  = q;
-            return out;
-        }
+            using algebra_t                   = A;
+            constexpr static width_t capacity = S;
 
-        constexpr auto select_grade(elem_t g) noexcept
-        {
-            rpne<A, S + 1> out;
-            out.append(*this);
-            out.nodes[out.count++] = node{op_grd, back().checksum + ~g, g};
-            out.q                  = q;
-            return out;
-        }
+            // To simplify processing, we arrange this structure so that each node maps to exactly
+            // one factor
+            node nodes[S];
+            // The count here can easily diverge from the capacity due to CSE and term elimination
+            width_t count = 0;
+            rat q{1, 1};
 
-        constexpr node* begin() noexcept
-        {
-            return nodes;
-        }
+            constexpr auto operator[](elem_t e) noexcept
+            {
+                rpne<A, S + 1> out;
+                out.append(*this);
+                // Using operator[] successfully is not expected behavior, so we don't bother
+                // computing the checksum in a fancy manner.
+                out.nodes[out.count++] = node{op_comp, back().checksum + e, e};
+                out.q                  = q;
+                return out;
+            }
 
-        constexpr node const* begin() const noexcept
-        {
-            return nodes;
-        }
+            constexpr auto select_grade(elem_t g) noexcept
+            {
+                rpne<A, S + 1> out;
+                out.append(*this);
+                out.nodes[out.count++] = node{op_grd, back().checksum + ~g, g};
+                out.q                  = q;
+                return out;
+            }
 
-        constexpr node* end() noexcept
-        {
-            return nodes + count;
-        }
+            constexpr node* begin() noexcept
+            {
+                return nodes;
+            }
 
-        constexpr node const* end() const noexcept
-        {
-            return nodes + count;
-        }
+            constexpr node const* begin() const noexcept
+            {
+                return nodes;
+            }
 
-        constexpr node pop() noexcept
-        {
-            return nodes[count--];
-        }
+            constexpr node* end() noexcept
+            {
+                return nodes + count;
+            }
 
-        constexpr void pop(width_t n) noexcept
-        {
-            count -= n;
-        }
+            constexpr node const* end() const noexcept
+            {
+                return nodes + count;
+            }
 
-        template <width_t S1>
-        constexpr void append(rpne<A, S1> const& src) noexcept
-        {
-            for (width_t i = 0; i != src.count; ++i)
+            constexpr node pop() noexcept
             {
-                nodes[count++] = src.nodes[i];
+                return nodes[count--];
             }
-        }
 
-        constexpr void append(node const& in) noexcept
-        {
-            nodes[count++] = in;
-        }
+            constexpr void pop(width_t n) noexcept
+            {
+                count -= n;
+            }
 
-        template <width_t S1>
-        constexpr void append_omit_ends(rpne<A, S1> const& src) noexcept
-        {
-            for (width_t i = 0; i != src.count - 1; ++i)
+            template <width_t S1>
+            constexpr void append(rpne<A, S1> const& src) noexcept
             {
-                nodes[count++] = src.nodes[i];
+                for (width_t i = 0; i != src.count; ++i)
+                {
+                    nodes[count++] = src.nodes[i];
+                }
             }
-        }
 
-        constexpr void append_cse(width_t i) noexcept
-        {
-            // The index to the ref passed here is 1-indexed (disambiguates it from a not-found
-            // result).
-            nodes[count++] = node{op_cse, 0, i - 1, zero};
-        }
+            constexpr void append(node const& in) noexcept
+            {
+                nodes[count++] = in;
+            }
 
-        constexpr void append_noop() noexcept
-        {
-            nodes[count++] = node{op_noop, 0, 0, zero};
-        }
+            template <width_t S1>
+            constexpr void append_omit_ends(rpne<A, S1> const& src) noexcept
+            {
+                for (width_t i = 0; i != src.count - 1; ++i)
+                {
+                    nodes[count++] = src.nodes[i];
+                }
+            }
 
-        template <width_t S1>
-        constexpr void append_as_se(rpne<A, S1> const& src) noexcept
-        {
-            nodes[count++] = node{op_se, 0, src.count, src.q};
-            for (width_t i = 0; i != src.count; ++i)
+            constexpr void append_cse(width_t i) noexcept
             {
-                nodes[count++] = src.nodes[i];
+                // The index to the ref passed here is 1-indexed (disambiguates it from a not-found
+                // result).
+                nodes[count++] = node{op_cse, 0, i - 1, zero};
             }
-        }
 
-        constexpr void append(op o) noexcept
-        {
-            nodes[count++] = {o, crc32((o << 8) + back().checksum)};
-        }
+            constexpr void append_noop() noexcept
+            {
+                nodes[count++] = node{op_noop, 0, 0, zero};
+            }
 
-        constexpr void append(op o, crc_t c) noexcept
-        {
-            nodes[count++] = {o, c};
-        }
+            template <width_t S1>
+            constexpr void append_as_se(rpne<A, S1> const& src) noexcept
+            {
+                nodes[count++] = node{op_se, 0, src.count, src.q};
+                for (width_t i = 0; i != src.count; ++i)
+                {
+                    nodes[count++] = src.nodes[i];
+                }
+            }
 
-        constexpr node& back() noexcept
-        {
-            return nodes[count - 1];
-        }
+            constexpr void append(op o) noexcept
+            {
+                nodes[count++] = {o, crc32((o << 8) + back().checksum)};
+            }
 
-        constexpr node const& back() const noexcept
-        {
-            return nodes[count - 1];
-        }
+            constexpr void append(op o, crc_t c) noexcept
+            {
+                nodes[count++] = {o, c};
+            }
 
-        template <width_t S1>
-        constexpr bool operator==(rpne<A, S1> const& other) const noexcept
-        {
-            if (count != other.count)
+            constexpr node& back() noexcept
+            {
+                return nodes[count - 1];
+            }
+
+            constexpr node const& back() const noexcept
             {
-                return false;
+                return nodes[count - 1];
             }
 
-            for (width_t i = 0; i != count; ++i)
+            template <width_t S1>
+            constexpr bool operator==(rpne<A, S1> const& other) const noexcept
             {
-                if (nodes[i] != other.nodes[i])
+                if (count != other.count)
                 {
                     return false;
                 }
-            }
 
-            return true;
-        }
-    };
+                for (width_t i = 0; i != count; ++i)
+                {
+                    if (nodes[i] != other.nodes[i])
+                    {
+                        return false;
+                    }
+                }
+
+                return true;
+            }
+        };
+    } // namespace GAL_RATIONAL_ABI
 
     template <typename A, size_t S, typename D, typename... Ds>
     constexpr auto rpne_entities(std::array<rpne<A, 1>, S>& out, uint32_t current_id, size_t i) noexcept
@@ -282,7 +292,7 @@ namespace detail
 
         if constexpr (sizeof...(Ds) > 0)
         {
-            if (std::is_floating_point_v<D>)
+            if constexpr (detail::is_field_v<D>)
             {
                 return rpne_entities<A, S, Ds...>(out, current_id + 1, i + 1);
             }
@@ -293,7 +303,7 @@ namespace detail
         }
         else
         {
-            if constexpr (std::is_floating_point_v<D>)
+            if constexpr (detail::is_field_v<D>)
             {
                 return ::gal::make_pair(current_id + 1, i + 1);
             }
@@ -901,33 +911,56 @@ constexpr auto tan(detail::rpne<A, S> const& in)
     return out;
 }
 
-// Closed-form exponential function
+// 1 or -1 according to the sign bit of a scalar, so that sign(0) = 1. Multiplying by it selects
+// between an element and its negation without branching, lane by lane.
+template <typename A, width_t S>
+constexpr auto sign(detail::rpne<A, S> const& in)
+{
+    detail::rpne<A, S + 1> out;
+    out.append(in);
+    out.append(detail::op_sign);
+    out.back().q = in.q;
+    out.q        = one;
+    return out;
+}
+
+// Closed-form exponential function. With B^2 = -x + p * I (I the pseudoscalar), the DFA reifies
+//
+//     exp(B) = C + p/2 * S * I + (S - p/2 * G * I) * B
+//
+// where C, S and G are the closed forms of exp_closed (closed_forms.hpp) evaluated at x. This
+// expands exp about the dual angle whose square is -B^2, so it is exact whenever the pseudoscalar
+// squares to zero (as in PGA) or B ^ B vanishes, and remains finite as x tends to zero
+// (translations).
 // NOTE: results are *undefined* when the arg is not a bivector
 template <typename A, width_t S>
 constexpr auto exp(detail::rpne<A, S> const& in)
 {
-    auto s        = (in | in)[0];
-    auto p        = (in ^ in)[(1 << A::metric_t::dimension) - 1];
-    auto u        = sqrt(-s);
-    auto v        = -p / (2 * u);
-    auto inv_norm = 1 / u + v / s * ::gal::detail::rpne_pseudoscalar<A>(1);
-    auto cosu     = cos(u);
-    auto sinu     = sin(u);
-    auto real     = cosu - v * sinu * ::gal::detail::rpne_pseudoscalar<A>(1);
-    auto ideal    = sinu + v * cosu * ::gal::detail::rpne_pseudoscalar<A>(1);
-    return real + ideal * inv_norm * in;
+    detail::rpne<A, S + 1> out;
+    out.append(in);
+    out.append(detail::op_exp);
+    out.back().q = in.q;
+    out.q        = one;
+    return out;
 }
 
-// Closed-form logarithmic function
-// NOTE: results are *undefined* when the arg is not a member of the even subalgebra
-// template <typename A, width_t S>
-// constexpr auto log(detail::rpne<A, S> const& in)
-// {
-//     detail::rpne<A, S + 1> out;
-//     out.append(in);
-//     out.append(detail::op_log);
-//     return out;
-// }
+// Closed-form logarithmic function, the inverse of exp above. With M = s + L + p * I (L the
+// bivector part), the DFA reifies
+//
+//     log(M) = (F - p * H * I) * L
+//
+// where F and H are the closed forms of log_closed (closed_forms.hpp) evaluated at s.
+// NOTE: results are *undefined* when the arg is not a normalized member of the even subalgebra
+template <typename A, width_t S>
+constexpr auto log(detail::rpne<A, S> const& in)
+{
+    detail::rpne<A, S + 1> out;
+    out.append(in);
+    out.append(detail::op_log);
+    out.back().q = in.q;
+    out.q        = one;
+    return out;
+}
 
 template <typename A, width_t S1, width_t S2>
 constexpr auto operator*(detail::rpne<A, S1> const& lhs, detail::rpne<A, S2> const& rhs)
@@ -1313,6 +1346,18 @@ std::string to_string(detail::rpne<A, S> const& in, bool show_checksums = false,
             str << "tan"
                 << "(" << n.q.num << '/' << n.q.den << ") ";
             break;
+        case op_sign:
+            str << "sign"
+                << "(" << n.q.num << '/' << n.q.den << ") ";
+            break;
+        case op_exp:
+            str << "exp"
+                << "(" << n.q.num << '/' << n.q.den << ") ";
+            break;
+        case op_log:
+            str << "log"
+                << "(" << n.q.num << '/' << n.q.den << ") ";
+            break;
         case c_zero:
             str << "0 ";
             break;
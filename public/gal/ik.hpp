@@ -0,0 +1,412 @@
+#pragma once
+
+#include "pga.hpp"
+#include "simd.hpp"
+#include "span.hpp"
+#include "vga.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+
+// Iterative inverse kinematics of joint chains by cyclic coordinate descent (CCD). Each sweep
+// visits the joints of a chain from the effector to the root, rotating each joint so that the
+// effector points towards the target as seen from the joint, within the joint's limit. Sweeps are
+// repeated until the effector is within a tolerance of the target or an iteration budget is spent.
+//
+// Many independent rigs sharing a chain length are solved at once: every SIMD lane holds a rig, so
+// the sandwich products and compositions of each step are evaluated as single kernels over
+// batch_width<T> rigs. Lanes whose rig has converged are frozen while the others keep iterating.
+// Chain storage is held on the stack, bounded by GAL_IK_CHAIN_CAPACITY.
+
+#ifndef GAL_IK_CHAIN_CAPACITY
+// Maximum number of joints in a chain
+#    define GAL_IK_CHAIN_CAPACITY 32
+#endif
+
+namespace gal
+{
+namespace pga
+{
+    template <typename T = float>
+    struct ik_settings
+    {
+        // Number of sweeps after which an unconverged rig is left as is
+        size_t max_iterations = 16;
+
+        // Distance between the effector and the target below which a rig has converged
+        T tolerance = T{1e-3};
+    };
+
+    struct ik_result
+    {
+        // False if the chain is longer than GAL_IK_CHAIN_CAPACITY or the spans are too small, in
+        // which case nothing is solved
+        bool valid = false;
+
+        // Number of rigs whose effector ended within tolerance of its target
+        size_t converged = 0;
+
+        // Largest number of sweeps performed for any rig
+        size_t iterations = 0;
+    };
+} // namespace pga
+
+namespace detail
+{
+    // Frame of a joint prior to its rotation, given the frame and rotation of its parent
+    constexpr inline auto ik_frame = [](auto f, auto r, auto o) { return f * r * o; };
+
+    constexpr inline auto ik_into_frame = [](auto f, auto p) { return ~f * p * f; };
+
+    constexpr inline auto ik_rotate = [](auto r, auto p) { return r * p * ~r; };
+
+    constexpr inline auto ik_compose = [](auto r, auto q) { return r * q; };
+
+    // Carries a point from the frame of a joint to the frame of its parent (after rotation)
+    constexpr inline auto ik_transport = [](auto o, auto r, auto p) {
+        auto m = o * r;
+        return m * p * ~m;
+    };
+
+    template <typename V>
+    using ik_rotor_t = entity<::gal::pga::pga_algebra, V, 0, 0b110, 0b1010, 0b1100>;
+
+    // The rotor about the origin turning the direction of a towards the direction of b (the
+    // normalized |a||b| + b * a for vectors), or the identity if either is zero or they are opposed
+    template <typename V>
+    GAL_FORCE_INLINE static ik_rotor_t<V> ik_align(::gal::vga::point<V> const& a,
+                                                   ::gal::vga::point<V> const& b) noexcept
+    {
+        using std::sqrt;
+        using T = scalar_t<V>;
+
+        V const a2 = a.x * a.x + a.y * a.y + a.z * a.z;
+        V const b2 = b.x * b.x + b.y * b.y + b.z * b.z;
+        V const ab = sqrt(a2 * b2);
+        ik_rotor_t<V> r{{ab + a.x * b.x + a.y * b.y + a.z * b.z,
+                         b.x * a.y - b.y * a.x,
+                         b.x * a.z - b.z * a.x,
+                         b.y * a.z - b.z * a.y}};
+
+        V norm2 = r[0] * r[0] + r[1] * r[1] + r[2] * r[2] + r[3] * r[3];
+        for (size_t lane = 0; lane != V::size(); ++lane)
+        {
+            if (!(norm2[lane] > T{1e-12} * ab[lane] * ab[lane]))
+            {
+                r[0][lane] = norm2[lane] = T{1};
+                r[1][lane] = r[2][lane] = r[3][lane] = T{0};
+            }
+        }
+
+        V const inv = V{T{1}} / sqrt(norm2);
+        for (size_t i = 0; i != 4; ++i)
+        {
+            r[i] *= inv;
+        }
+        return r;
+    }
+
+    // Limits the rotation angle of a normalized rotor (cos_half and sin_half are taken of half the
+    // limit). The rotor is first brought to the hemisphere of rotations of at most pi.
+    template <typename V, typename T>
+    GAL_FORCE_INLINE static void ik_limit(ik_rotor_t<V>& r, T cos_half, T sin_half) noexcept
+    {
+        using std::sqrt;
+        for (size_t lane = 0; lane != V::size(); ++lane)
+        {
+            T sign = r[0][lane] < T{0} ? T{-1} : T{1};
+            T s    = sign * r[0][lane];
+            if (s >= cos_half)
+            {
+                for (size_t i = 0; i != 4; ++i)
+                {
+                    r[i][lane] *= sign;
+                }
+                continue;
+            }
+
+            T b2 = r[1][lane] * r[1][lane] + r[2][lane] * r[2][lane] + r[3][lane] * r[3][lane];
+            T scale    = b2 > T{0} ? sign * sin_half / sqrt(b2) : T{0};
+            r[0][lane] = cos_half;
+            for (size_t i = 1; i != 4; ++i)
+            {
+                r[i][lane] *= scale;
+            }
+        }
+    }
+
+    template <size_t W, typename T, typename O, typename E, typename P>
+    static size_t ik_solve_block(size_t joints,
+                                 span<::gal::pga::motor<T>> rotations,
+                                 span<O> offsets,
+                                 std::array<T, GAL_IK_CHAIN_CAPACITY> const& cos_half,
+                                 std::array<T, GAL_IK_CHAIN_CAPACITY> const& sin_half,
+                                 span<E> effectors,
+                                 span<P> targets,
+                                 ::gal::pga::ik_settings<T> const& settings,
+                                 span<T> errors,
+                                 size_t first,
+                                 size_t count,
+                                 size_t& iterations) noexcept
+    {
+        using V       = simd<T, W>;
+        using motor_t = ::gal::pga::motor<V>;
+        using block_t = aosoa_block<::gal::pga::motor<T>, W>;
+        using point_t = ::gal::vga::point<V>;
+        using rotor_t = ik_rotor_t<V>;
+
+        std::array<block_t, GAL_IK_CHAIN_CAPACITY> offset;
+        std::array<rotor_t, GAL_IK_CHAIN_CAPACITY> rotation;
+        std::array<block_t, GAL_IK_CHAIN_CAPACITY> frame;
+        point_t effector{V{}, V{}, V{}};
+        point_t target{V{}, V{}, V{}};
+
+        // Lanes past the last rig replicate it
+        for (size_t lane = 0; lane != W; ++lane)
+        {
+            size_t const rig = first + std::min(lane, count - 1);
+            for (size_t j = 0; j != joints; ++j)
+            {
+                auto const& o = offsets[rig * joints + j];
+                auto const& r = rotations[rig * joints + j];
+                for (size_t i = 0; i != 8; ++i)
+                {
+                    offset[j][i][lane] = o[i];
+                }
+                // The rotor part of the motor (elements 0, e12, e13 and e23)
+                rotation[j][0][lane] = r[0];
+                rotation[j][1][lane] = r[3];
+                rotation[j][2][lane] = r[5];
+                rotation[j][3][lane] = r[6];
+            }
+            for (size_t i = 0; i != 3; ++i)
+            {
+                effector[i][lane] = effectors[rig][i];
+                target[i][lane]   = targets[rig][i];
+            }
+        }
+
+        T const tolerance2 = settings.tolerance * settings.tolerance;
+        V error2;
+        std::array<bool, W> converged{};
+        size_t iteration = 0;
+        for (;; ++iteration)
+        {
+            // Frames of every joint prior to its rotation for the current pose
+            frame[0] = offset[0];
+            for (size_t j = 1; j != joints; ++j)
+            {
+                frame[j].data_ = motor_t{compute<::gal::pga::pga_algebra>(
+                                             ik_frame, frame[j - 1], rotation[j - 1], offset[j])}
+                                     .data;
+            }
+
+            // The effector and target are compared in the frame of the last joint
+            point_t tip
+                = compute<::gal::pga::pga_algebra>(ik_rotate, rotation[joints - 1], effector);
+            point_t goal
+                = compute<::gal::pga::pga_algebra>(ik_into_frame, frame[joints - 1], target);
+            error2 = (tip.x - goal.x) * (tip.x - goal.x) + (tip.y - goal.y) * (tip.y - goal.y)
+                     + (tip.z - goal.z) * (tip.z - goal.z);
+
+            bool done = true;
+            for (size_t lane = 0; lane != W; ++lane)
+            {
+                converged[lane] = error2[lane] <= tolerance2;
+                done            = done && (converged[lane] || lane >= count);
+            }
+            if (done || iteration == settings.max_iterations)
+            {
+                break;
+            }
+
+            // Sweep from the effector to the root, tracking the effector in the frame of the joint
+            // being visited (after its rotation)
+            point_t reach = effector;
+            for (size_t j = joints; j-- != 0;)
+            {
+                point_t a = compute<::gal::pga::pga_algebra>(ik_rotate, rotation[j], reach);
+                point_t b = compute<::gal::pga::pga_algebra>(ik_into_frame, frame[j], target);
+
+                rotor_t updated = compute<::gal::pga::pga_algebra>(
+                    ik_compose, detail::ik_align(a, b), rotation[j]);
+                detail::ik_limit(updated, cos_half[j], sin_half[j]);
+                for (size_t lane = 0; lane != W; ++lane)
+                {
+                    if (converged[lane])
+                    {
+                        continue;
+                    }
+                    for (size_t i = 0; i != 4; ++i)
+                    {
+                        rotation[j][i][lane] = updated[i][lane];
+                    }
+                }
+
+                if (j != 0)
+                {
+                    reach = compute<::gal::pga::pga_algebra>(
+                        ik_transport, offset[j], rotation[j], reach);
+                }
+            }
+        }
+
+        size_t converged_count = 0;
+        for (size_t lane = 0; lane != count; ++lane)
+        {
+            size_t const rig = first + lane;
+            for (size_t j = 0; j != joints; ++j)
+            {
+                rotations[rig * joints + j] = {rotation[j][0][lane],
+                                               T{0},
+                                               T{0},
+                                               rotation[j][1][lane],
+                                               T{0},
+                                               rotation[j][2][lane],
+                                               rotation[j][3][lane],
+                                               T{0}};
+            }
+            if (!errors.empty())
+            {
+                errors[rig] = std::sqrt(error2[lane]);
+            }
+            converged_count += converged[lane] ? 1 : 0;
+        }
+        iterations = std::max(iterations, iteration);
+        return converged_count;
+    }
+
+    template <typename T, typename O, typename L, typename E, typename P, typename X>
+    static ::gal::pga::ik_result ik_solve(size_t joints,
+                                          span<::gal::pga::motor<T>> rotations,
+                                          span<O> offsets,
+                                          span<L> limits,
+                                          span<E> effectors,
+                                          span<P> targets,
+                                          ::gal::pga::ik_settings<T> const& settings,
+                                          span<T> errors,
+                                          X executor)
+    {
+        constexpr size_t W = batch_width<T>;
+        size_t const rigs  = targets.size();
+
+        ::gal::pga::ik_result result;
+        if (joints == 0 || joints > GAL_IK_CHAIN_CAPACITY || rotations.size() < rigs * joints
+            || offsets.size() < rigs * joints || limits.size() < joints || effectors.size() < rigs
+            || (!errors.empty() && errors.size() < rigs))
+        {
+            return result;
+        }
+
+        std::array<T, GAL_IK_CHAIN_CAPACITY> cos_half{};
+        std::array<T, GAL_IK_CHAIN_CAPACITY> sin_half{};
+        for (size_t j = 0; j != joints; ++j)
+        {
+            T const half = std::min(static_cast<T>(limits[j]), T{3.14159265358979323846}) / T{2};
+            cos_half[j]  = std::cos(half);
+            sin_half[j]  = std::sin(half);
+        }
+
+        // Solves rigs [first, first + count), batch_width<T> rigs at a time
+        auto solve_range = [&](size_t first, size_t count, size_t& iterations) {
+            size_t converged  = 0;
+            size_t const last = first + count;
+            for (size_t block = first; block < last; block += W)
+            {
+                converged += detail::ik_solve_block<W>(joints,
+                                                       rotations,
+                                                       offsets,
+                                                       cos_half,
+                                                       sin_half,
+                                                       effectors,
+                                                       targets,
+                                                       settings,
+                                                       errors,
+                                                       block,
+                                                       std::min(W, last - block),
+                                                       iterations);
+            }
+            return converged;
+        };
+
+        result.valid = true;
+        if constexpr (std::is_same_v<X, std::nullptr_t>)
+        {
+            result.converged = solve_range(0, rigs, result.iterations);
+        }
+        else
+        {
+            // Chunks are a multiple of the batch width so only the last block of all is partial
+            size_t const chunks = executor->concurrency() * 4;
+            size_t const target = (rigs + chunks - 1) / chunks;
+            size_t const chunk  = std::max<size_t>((target + W - 1) / W * W, W);
+
+            std::atomic<size_t> converged{0};
+            std::atomic<size_t> iterations{0};
+            executor->parallel_for((rigs + chunk - 1) / chunk, [&](size_t index) {
+                size_t const first = index * chunk;
+                size_t local       = 0;
+                converged += solve_range(first, std::min(chunk, rigs - first), local);
+
+                size_t previous = iterations.load();
+                while (previous < local && !iterations.compare_exchange_weak(previous, local))
+                {
+                }
+            });
+            result.converged  = converged.load();
+            result.iterations = iterations.load();
+        }
+        return result;
+    }
+} // namespace detail
+
+namespace pga
+{
+    // Solves the joint chains of many rigs by cyclic coordinate descent. The chain of every rig
+    // has the given number of joints, and joint j of rig r is stored at r * joints + j of the
+    // rotations and offsets spans.
+    //
+    // - offsets place each joint in the frame of its parent after the parent's rotation (the first
+    //   joint is placed in world space)
+    // - rotations hold the rotor of each joint (the rotor part of a motor). They are used as the
+    //   initial pose and overwritten with the solution.
+    // - limits hold the largest angle each joint may rotate away from rest (the identity). Limits
+    //   of pi or more leave a joint unconstrained.
+    // - effectors hold the effector of each rig in the frame of its last joint (after rotation),
+    //   and targets the position each effector should reach in world space
+    // - errors, if not empty, receive the final distance between each effector and its target
+    template <typename T, typename O, typename L, typename E, typename P>
+    ik_result solve_ik(size_t joints,
+                       span<motor<T>> rotations,
+                       span<O> offsets,
+                       span<L> limits,
+                       span<E> effectors,
+                       span<P> targets,
+                       ik_settings<T> const& settings = {},
+                       span<T> errors                 = {}) noexcept
+    {
+        return ::gal::detail::ik_solve(
+            joints, rotations, offsets, limits, effectors, targets, settings, errors, nullptr);
+    }
+
+    // Splits the rigs into chunks solved by an executor (see parallel_compute)
+    template <typename X, typename T, typename O, typename L, typename E, typename P>
+    ik_result parallel_solve_ik(X& executor,
+                                size_t joints,
+                                span<motor<T>> rotations,
+                                span<O> offsets,
+                                span<L> limits,
+                                span<E> effectors,
+                                span<P> targets,
+                                ik_settings<T> const& settings = {},
+                                span<T> errors                 = {})
+    {
+        return ::gal::detail::ik_solve(
+            joints, rotations, offsets, limits, effectors, targets, settings, errors, &executor);
+    }
+} // namespace pga
+} // namespace gal
@@ -0,0 +1,102 @@
+#pragma once
+
+#include "opt.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+
+namespace gal
+{
+// Dense row-major matrix used to hand results to code outside of GAL (renderers, physics engines)
+// which consumes rigid transforms as 3x4 or 4x4 matrices. Like the entities, the value type may be
+// a simd type, in which case each entry holds the lanes of several independent matrices.
+template <typename T, size_t R, size_t C>
+struct matrix
+{
+    using value_t = T;
+
+    std::array<T, R * C> data;
+
+    GAL_NODISCARD constexpr static size_t rows() noexcept
+    {
+        return R;
+    }
+
+    GAL_NODISCARD constexpr static size_t cols() noexcept
+    {
+        return C;
+    }
+
+    GAL_NODISCARD constexpr static size_t size() noexcept
+    {
+        return R * C;
+    }
+
+    GAL_NODISCARD constexpr T const& operator()(size_t row, size_t col) const noexcept
+    {
+        return data[row * C + col];
+    }
+
+    GAL_NODISCARD constexpr T& operator()(size_t row, size_t col) noexcept
+    {
+        return data[row * C + col];
+    }
+
+    // Entries in row-major order
+    GAL_NODISCARD constexpr T const& operator[](size_t index) const noexcept
+    {
+        return data[index];
+    }
+
+    GAL_NODISCARD constexpr T& operator[](size_t index) noexcept
+    {
+        return data[index];
+    }
+};
+
+namespace detail
+{
+    // Returns the unit quaternion {w, x, y, z} of the rotation stored in the upper-left 3x3 block
+    // of a matrix. The quaternion is extracted from the largest of the trace and the diagonal
+    // entries so the square root and division remain well conditioned for any rotation angle.
+    template <typename T, size_t R, size_t C>
+    GAL_NODISCARD std::array<T, 4> rotation_quaternion(matrix<T, R, C> const& m) noexcept
+    {
+        using std::sqrt;
+        T trace = m(0, 0) + m(1, 1) + m(2, 2);
+        if (trace > T{0})
+        {
+            T s = T{0.5} / sqrt(trace + T{1});
+            return {T{0.25} / s,
+                    (m(2, 1) - m(1, 2)) * s,
+                    (m(0, 2) - m(2, 0)) * s,
+                    (m(1, 0) - m(0, 1)) * s};
+        }
+        else if (m(0, 0) > m(1, 1) && m(0, 0) > m(2, 2))
+        {
+            T s = T{0.5} / sqrt(T{1} + m(0, 0) - m(1, 1) - m(2, 2));
+            return {(m(2, 1) - m(1, 2)) * s,
+                    T{0.25} / s,
+                    (m(0, 1) + m(1, 0)) * s,
+                    (m(0, 2) + m(2, 0)) * s};
+        }
+        else if (m(1, 1) > m(2, 2))
+        {
+            T s = T{0.5} / sqrt(T{1} + m(1, 1) - m(0, 0) - m(2, 2));
+            return {(m(0, 2) - m(2, 0)) * s,
+                    (m(0, 1) + m(1, 0)) * s,
+                    T{0.25} / s,
+                    (m(1, 2) + m(2, 1)) * s};
+        }
+        else
+        {
+            T s = T{0.5} / sqrt(T{1} + m(2, 2) - m(0, 0) - m(1, 1));
+            return {(m(1, 0) - m(0, 1)) * s,
+                    (m(0, 2) + m(2, 0)) * s,
+                    (m(1, 2) + m(2, 1)) * s,
+                    T{0.25} / s};
+        }
+    }
+} // namespace detail
+} // namespace gal
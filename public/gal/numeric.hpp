@@ -5,7 +5,9 @@
 #include <cstdint>
 #include <limits>
 #include <numeric>
+#include <type_traits>
 
+#include "closed_forms.hpp"
 #include "opt.hpp"
 
 #ifdef _MSC_VER
@@ -14,6 +16,24 @@
 
 namespace gal
 {
+namespace detail
+{
+    // Describes the value types (fields) entities may be defined over. Scalar floating-point types
+    // are supported natively and SIMD lanes are registered in simd.hpp.
+    template <typename T>
+    struct field_traits
+    {
+        constexpr static bool is_field = std::is_floating_point_v<T>;
+        using scalar_t                 = T;
+    };
+
+    template <typename T>
+    constexpr inline bool is_field_v = field_traits<T>::is_field;
+
+    template <typename T>
+    using scalar_t = typename field_traits<T>::scalar_t;
+} // namespace detail
+
 // right-to-left binary exponentiation
 template <typename T, int N, int D>
 [[nodiscard]] GAL_FORCE_INLINE constexpr T
@@ -21,7 +41,9 @@ pow(T s, std::integral_constant<int, N>, std::integral_constant<int, D>) noexcep
 {
     if constexpr (D > 1)
     {
-        return std::pow(s, T{N} / T{D});
+        // Unqualified to permit SIMD value types
+        using std::pow;
+        return pow(s, T{N} / T{D});
     }
     else if constexpr (N == 1)
     {
@@ -90,6 +112,62 @@ pow(T s, std::integral_constant<int, N>, std::integral_constant<int, D>) noexcep
     }
 }
 
+// 1 or -1 according to the sign bit of x (see sign in expr.hpp)
+template <typename T, typename = std::enable_if_t<std::is_floating_point_v<T>>>
+[[nodiscard]] GAL_FORCE_INLINE T sign(T x) noexcept
+{
+    return std::copysign(T{1}, x);
+}
+
+// Single results of the closed forms of closed_forms.hpp
+template <typename T>
+[[nodiscard]] GAL_FORCE_INLINE T exp_even(T x) noexcept
+{
+    T even;
+    T odd;
+    T dual;
+    exp_closed(x, even, odd, dual);
+    return even;
+}
+
+template <typename T>
+[[nodiscard]] GAL_FORCE_INLINE T exp_odd(T x) noexcept
+{
+    T even;
+    T odd;
+    T dual;
+    exp_closed(x, even, odd, dual);
+    return odd;
+}
+
+template <typename T>
+[[nodiscard]] GAL_FORCE_INLINE T exp_dual(T x) noexcept
+{
+    T even;
+    T odd;
+    T dual;
+    exp_closed(x, even, odd, dual);
+    return dual;
+}
+
+template <typename T>
+[[nodiscard]] GAL_FORCE_INLINE T log_odd(T x) noexcept
+{
+    T odd;
+    T dual;
+    log_closed(x, odd, dual);
+    return odd;
+}
+
+template <typename T>
+[[nodiscard]] GAL_FORCE_INLINE T log_dual(T x) noexcept
+{
+    T odd;
+    T dual;
+    log_closed(x, odd, dual);
+    return dual;
+}
+
 template <typename T>
 [[nodiscard]] constexpr T next_pow_2(T s) noexcept
 {
@@ -160,123 +238,200 @@ template <typename T>
 #endif
 }
 
+#ifndef GAL_RATIONAL_BITS
+// Width in bits (32 or 64) of the numerator and denominator of the rationals scaling monomials and
+// terms during compile-time reduction. With 32-bit rationals, irreducible fractions with large
+// denominators are nudged to nearby fractions to stave off overflow (see detail::overflow_gate).
+// The inexact coefficients this leaves behind no longer cancel, so long products such as deep
+// motor chains may reify to more terms than necessary. Defining this as 64 keeps coefficients exact
+// unless they genuinely exceed 64 bits, at the cost of memory and time during compilation. The
+// setting applies to every algebra in a translation unit.
+#    define GAL_RATIONAL_BITS 32
+#endif
+
+// The types holding rationals (rat, the ind, mon and mv of algebra.hpp, the node and rpne of
+// expr.hpp and the runtime expressions, contexts and programs) are declared in an inline namespace
+// named after the width. Their names are unchanged, but translation units built with different
+// widths mangle them differently, so passing one between such translation units fails to link
+// instead of silently violating the one definition rule.
+#if GAL_RATIONAL_BITS == 32
+#    define GAL_RATIONAL_ABI rat32
 using num_t = int32_t;
 // Even though the denominator will always be kept greater than zero as an invariant, it is
 // convenient for several operations to use the signed quantity as an intermediate quantity.
 using den_t = int32_t;
+#elif GAL_RATIONAL_BITS == 64
+#    ifndef __SIZEOF_INT128__
+#        error "64-bit rationals require 128-bit integer support for intermediate results"
+#    endif
+#    define GAL_RATIONAL_ABI rat64
+using num_t = int64_t;
+using den_t = int64_t;
+#else
+#    error "GAL_RATIONAL_BITS must be either 32 or 64"
+#endif
 
-// The module we work with is attached to the field of rational numbers.
-// The numerator and denominator are left as ints (even though D > 0 is an invariant) so the
-// compiler can help detect overflows
-struct rat
+namespace detail
 {
-    num_t num = 0;
-    den_t den = 1;
+    // Rational products and sums are formed at twice the width of num_t and only narrowed after
+    // reduction so that results which are representable never overflow along the way
+#if GAL_RATIONAL_BITS == 32
+    using rat_wide_t = int64_t;
+#else
+    __extension__ typedef __int128 rat_wide_t;
+#endif
+} // namespace detail
 
-    [[nodiscard]] constexpr bool is_zero() const noexcept
+inline namespace GAL_RATIONAL_ABI
+{
+    // The module we work with is attached to the field of rational numbers.
+    // The numerator and denominator are left as ints (even though D > 0 is an invariant) so the
+    // compiler can help detect overflows
+    struct rat
     {
-        return num == 0;
-    }
+        num_t num = 0;
+        den_t den = 1;
 
-    [[nodiscard]] constexpr bool is_unit() const noexcept
-    {
-        return num == den;
-    }
+        [[nodiscard]] constexpr bool is_zero() const noexcept
+        {
+            return num == 0;
+        }
+
+        [[nodiscard]] constexpr bool is_unit() const noexcept
+        {
+            return num == den;
+        }
+
+        [[nodiscard]] constexpr rat reciprocal() const noexcept
+        {
+            return {den, num};
+        }
+
+        [[nodiscard]] constexpr rat negation() const noexcept
+        {
+            return {-num, den};
+        }
+
+        constexpr rat& operator/=(rat other) noexcept
+        {
+            this->operator*=(other.reciprocal());
+            return *this;
+        }
+
+        constexpr rat& operator*=(rat other) noexcept;
+
+        constexpr rat& operator+=(rat other) noexcept;
+
+        template <typename T>
+        [[nodiscard]] constexpr operator T() const noexcept
+        {
+            static_assert(std::is_floating_point_v<T>,
+                          "Attempting to cast a rational number to non-floating-point type.");
+            return static_cast<T>(num) / static_cast<T>(den);
+        }
+    };
+} // namespace GAL_RATIONAL_ABI
+
+// Common rational types used for brevity
+constexpr inline rat one{1, 1};
+constexpr inline rat minus_one{-1, 1};
+constexpr inline rat one_half{1, 2};
+constexpr inline rat minus_one_half{-1, 2};
+constexpr inline rat zero{0, 1};
 
-    [[nodiscard]] constexpr rat reciprocal() const noexcept
+namespace detail
+{
+    template <typename T>
+    [[nodiscard]] constexpr T abs(T in) noexcept
     {
-        return {den, num};
+        return in < 0 ? -in : in;
     }
 
-    [[nodiscard]] constexpr rat negation() const noexcept
+    // std::gcd is not required to accept the 128-bit intermediates
+    [[nodiscard]] constexpr rat_wide_t wide_gcd(rat_wide_t lhs, rat_wide_t rhs) noexcept
     {
-        return {-num, den};
+        lhs = abs(lhs);
+        rhs = abs(rhs);
+        while (rhs != 0)
+        {
+            rat_wide_t r = lhs % rhs;
+            lhs          = rhs;
+            rhs          = r;
+        }
+        return lhs;
     }
 
-    constexpr rat& operator/=(rat other) noexcept
+    [[nodiscard]] constexpr bool fits_rat(rat_wide_t in) noexcept
     {
-        this->operator*=(other.reciprocal());
-        return *this;
+        return abs(in) <= std::numeric_limits<num_t>::max();
     }
 
-    constexpr rat& operator*=(rat other) noexcept
+    // Reduces num/den to lowest terms with a positive denominator. The result is exact whenever the
+    // reduced fraction is representable. Otherwise, the numerator and denominator are halved
+    // together (stepping to one of the fractions the input is a mediant of) until it is.
+    [[nodiscard]] constexpr rat narrow(rat_wide_t num, rat_wide_t den) noexcept
     {
-        num *= other.num;
-        den *= other.den;
         if (num == 0)
         {
-            den = 1;
+            return zero;
         }
-        else if (den > 1)
+
+        if (den < 0)
         {
-            auto gcd = std::gcd(num, den);
-            if (gcd > 1)
-            {
-                num /= gcd;
-                den /= gcd;
-            }
+            num = -num;
+            den = -den;
         }
-        return *this;
-    }
 
-    constexpr rat& operator+=(rat other) noexcept
-    {
-        num = num * other.den + other.num * den;
-        if (num == 0)
+        rat_wide_t gcd = wide_gcd(num, den);
+        if (gcd > 1)
         {
-            den = 1;
+            num /= gcd;
+            den /= gcd;
         }
-        else
+
+        if (!fits_rat(num) || !fits_rat(den))
         {
-            den = den * other.den;
-            if (den > 1)
+            while (!fits_rat(num) || !fits_rat(den))
             {
-                auto gcd = std::gcd(num, den);
-                if (gcd > 1)
+                if (den == 1)
                 {
-                    num /= gcd;
-                    den /= gcd;
+                    // Nothing left to trade off against, so saturate
+                    return {num < 0 ? -std::numeric_limits<num_t>::max()
+                                    : std::numeric_limits<num_t>::max(),
+                            1};
                 }
+                num /= 2;
+                den /= 2;
             }
-        }
-        return *this;
-    }
-
-    template <typename T>
-    [[nodiscard]] constexpr operator T() const noexcept
-    {
-        static_assert(std::is_floating_point_v<T>,
-                      "Attempting to cast a rational number to non-floating-point type.");
-        return static_cast<T>(num) / static_cast<T>(den);
-    }
-};
 
-// Common rational types used for brevity
-constexpr inline rat one{1, 1};
-constexpr inline rat minus_one{-1, 1};
-constexpr inline rat one_half{1, 2};
-constexpr inline rat minus_one_half{-1, 2};
-constexpr inline rat zero{0, 1};
+            if (num == 0)
+            {
+                return zero;
+            }
 
-namespace detail
-{
-    [[nodiscard]] constexpr num_t abs(num_t in) noexcept
-    {
-        return in < 0 ? -in : in;
-    }
+            gcd = wide_gcd(num, den);
+            if (gcd > 1)
+            {
+                num /= gcd;
+                den /= gcd;
+            }
+        }
 
-    [[nodiscard]] constexpr double abs(double in) noexcept
-    {
-        return in < 0.0 ? -in : in;
+        return {static_cast<num_t>(num), static_cast<den_t>(den)};
     }
 
-    [[nodiscard]] constexpr rat overflow_gate(rat in) noexcept
+    [[nodiscard]] constexpr rat overflow_gate(rat_wide_t num, rat_wide_t den) noexcept
     {
         // As expressions expand, there may be cases where terms becoming vanishingly small or N and
         // D become great enough to risk overflow. This function is a pure function which
         // deterministically nudges the result so that compilation stays fast without sacrificing
         // too much precision.
 
+#if GAL_RATIONAL_BITS == 64
+        // With 64-bit rationals, the headroom is large enough that results are only ever
+        // approximated when they genuinely don't fit.
+        return narrow(num, den);
+#else
         // The goal is to at least match the precision that would have been afforded with floating
         // point precision for the range of numbers dealt with.
 
@@ -297,85 +452,60 @@ namespace detail
         // rationals encountered is itself biased, but cheap to compute and difficult to beat
         // without introducing unreasonable amounts of complexity and compilation time.
 
-        if (in.den < (1 << 10))
+        if (num == 0 || abs(den) < (1 << 10) || wide_gcd(num, den) > 1)
         {
-            auto gcd = std::gcd(in.num, in.den);
-            if (gcd > 1)
+            return narrow(num, den);
+        }
+
+        rat in         = narrow(num, den);
+        double n_d     = static_cast<double>(in.num);
+        double d_d     = static_cast<double>(in.den);
+        double epsilon = abs(n_d / d_d / d_d);
+        double frac    = n_d / d_d;
+
+        if (abs(frac) < 1e-7)
+        {
+            return zero;
+        }
+        else if (epsilon < 1e-7)
+        {
+            // The rational is the mediant of two fractions with smaller denominators. Pick one of
+            // them based on the parity.
+            if (in.num % 2 == 1)
             {
-                return {in.num / gcd, in.den / gcd};
+                // Perturb to the left-side of the mediant
+                return narrow((in.num - 1) / 2, in.den / 2);
             }
             else
             {
-                return in;
+                // Perturb to the right-side of the mediant
+                return narrow(in.num / 2, (in.den - 1) / 2);
             }
         }
         else
         {
-            auto gcd = std::gcd(in.num, in.den);
-            if (gcd > 1)
-            {
-                return {in.num / gcd, in.den / gcd};
-            }
-            else
-            {
-                double n_d     = static_cast<double>(in.num);
-                double d_d     = static_cast<double>(in.den);
-                double epsilon = abs(n_d / d_d / d_d);
-                double frac    = n_d / d_d;
-
-                if (abs(frac) < 1e-7)
-                {
-                    return zero;
-                }
-                else if (epsilon < 1e-7)
-                {
-                    // The rational is the mediant of two fractions with smaller denominators. Pick
-                    // one of them based on the parity.
-                    if (in.num % 2 == 1)
-                    {
-                        // Perturb to the left-side of the mediant
-                        auto n2  = (in.num - 1) / 2;
-                        auto d2  = in.den / 2;
-                        auto gcd = std::gcd(n2, d2);
-                        if (gcd > 1)
-                        {
-                            return {n2 / gcd, d2 / gcd};
-                        }
-                        else
-                        {
-                            return {n2, d2};
-                        }
-                    }
-                    else
-                    {
-                        // Perturb to the right-side of the mediant
-                        auto n2  = in.num / 2;
-                        auto d2  = (in.den - 1) / 2;
-                        auto gcd = std::gcd(n2, d2);
-                        if (gcd > 1)
-                        {
-                            return {n2 / gcd, d2 / gcd};
-                        }
-                        else
-                        {
-                            return {n2, d2};
-                        }
-                    }
-                }
-                else
-                {
-                    return in;
-                }
-            }
+            return in;
         }
+#endif
     }
 } // namespace detail
 
+constexpr rat& rat::operator*=(rat other) noexcept
+{
+    return *this = detail::narrow(detail::rat_wide_t{num} * other.num,
+                                  detail::rat_wide_t{den} * other.den);
+}
+
+constexpr rat& rat::operator+=(rat other) noexcept
+{
+    return *this = detail::narrow(detail::rat_wide_t{num} * other.den
+                                      + detail::rat_wide_t{other.num} * den,
+                                  detail::rat_wide_t{den} * other.den);
+}
+
 [[nodiscard]] constexpr bool operator==(rat lhs, rat rhs) noexcept
 {
-    auto gcd1 = std::gcd(lhs.num, lhs.den);
-    auto gcd2 = std::gcd(rhs.den, rhs.den);
-    return lhs.num / gcd1 == rhs.num / gcd2 && lhs.den / gcd1 == rhs.den / gcd2;
+    return detail::rat_wide_t{lhs.num} * rhs.den == detail::rat_wide_t{rhs.num} * lhs.den;
 }
 
 [[nodiscard]] constexpr bool operator!=(rat lhs, int rhs) noexcept
@@ -390,12 +520,12 @@ namespace detail
 
 [[nodiscard]] constexpr bool operator<(rat lhs, rat rhs) noexcept
 {
-    return (lhs.num * rhs.den) < (rhs.num * lhs.den);
+    return detail::rat_wide_t{lhs.num} * rhs.den < detail::rat_wide_t{rhs.num} * lhs.den;
 }
 
 [[nodiscard]] constexpr bool operator>(rat lhs, rat rhs) noexcept
 {
-    return (lhs.num * rhs.den) > (rhs.num * lhs.den);
+    return detail::rat_wide_t{lhs.num} * rhs.den > detail::rat_wide_t{rhs.num} * lhs.den;
 }
 
 [[nodiscard]] constexpr rat operator-(rat in) noexcept
@@ -405,98 +535,32 @@ namespace detail
 
 [[nodiscard]] constexpr rat operator*(int lhs, rat rhs) noexcept
 {
-    if (lhs == 0 || rhs.num == 0)
-    {
-        return zero;
-    }
-    else
-    {
-        return {rhs.num * lhs, rhs.den};
-    }
+    return detail::narrow(detail::rat_wide_t{rhs.num} * lhs, rhs.den);
 }
 
 [[nodiscard]] constexpr rat operator*(rat lhs, rat rhs) noexcept
 {
-    rat product{lhs.num * rhs.num, lhs.den * rhs.den};
-    if (product.num == 0)
-    {
-        return zero;
-    }
-    else if (product.den > 1)
-    {
-        // Periodically reduce the fraction if possible to prevent overflow
-        return detail::overflow_gate(product);
-    }
-    else
-    {
-        return product;
-    }
+    // Periodically reduce the fraction if possible to prevent overflow
+    return detail::overflow_gate(detail::rat_wide_t{lhs.num} * rhs.num,
+                                 detail::rat_wide_t{lhs.den} * rhs.den);
 }
 
 [[nodiscard]] constexpr rat operator/(rat lhs, int rhs) noexcept
 {
-    if (rhs < 0)
-    {
-        lhs.num = -lhs.num;
-        lhs.den *= -rhs;
-    }
-    else
-    {
-        lhs.den *= rhs;
-    }
-    return detail::overflow_gate(lhs);
+    return detail::overflow_gate(lhs.num, detail::rat_wide_t{lhs.den} * rhs);
 }
 
 [[nodiscard]] constexpr rat operator/(rat lhs, rat rhs) noexcept
 {
-    rat quotient{lhs.num * rhs.den, rhs.num * lhs.den};
-    if (quotient.num == 0)
-    {
-        return zero;
-    }
-    else if (detail::abs(quotient.den) > 1)
-    {
-        if (quotient.den < 0)
-        {
-            return detail::overflow_gate(rat{-quotient.num, -quotient.den});
-        }
-        else
-        {
-            return detail::overflow_gate(quotient);
-        }
-    }
-    else
-    {
-        if (quotient.den < 0)
-        {
-            return {-quotient.num, -quotient.den};
-        }
-        else
-        {
-            return quotient;
-        }
-    }
+    return detail::overflow_gate(detail::rat_wide_t{lhs.num} * rhs.den,
+                                 detail::rat_wide_t{rhs.num} * lhs.den);
 }
 
 [[nodiscard]] constexpr rat operator+(rat lhs, rat rhs) noexcept
 {
-    int n = lhs.num * rhs.den + rhs.num * lhs.den;
-    if (n == 0)
-    {
-        return zero;
-    }
-    else
-    {
-        int d = lhs.den * rhs.den;
-        if (d > 1)
-        {
-            return detail::overflow_gate(rat{n, d});
-        }
-        else
-        {
-            return {n, d};
-        }
-    }
+    return detail::overflow_gate(detail::rat_wide_t{lhs.num} * rhs.den
+                                     + detail::rat_wide_t{rhs.num} * lhs.den,
+                                 detail::rat_wide_t{lhs.den} * rhs.den);
 }
 
 [[nodiscard]] constexpr auto operator-(rat lhs, rat rhs) noexcept
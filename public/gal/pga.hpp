@@ -3,6 +3,7 @@
 #include "engine.hpp"
 #include "entity.hpp"
 #include "geometric_algebra.hpp"
+#include "matrix.hpp"
 
 #include <cmath>
 
@@ -151,7 +152,8 @@ namespace pga
         // vectors of zero length. This is not checked for!
         void normalize() noexcept
         {
-            auto l2_inv = T{1} / std::sqrt(x * x + y * y + z * z);
+            using std::sqrt;
+            auto l2_inv = T{1} / sqrt(x * x + y * y + z * z);
             x           = x * l2_inv;
             y           = y * l2_inv;
             z           = z * l2_inv;
@@ -223,7 +225,8 @@ namespace pga
         // vectors of zero length. This is not checked for!
         void normalize() noexcept
         {
-            auto l2_inv = T{1} / std::sqrt(x * x + y * y + z * z);
+            using std::sqrt;
+            auto l2_inv = T{1} / sqrt(x * x + y * y + z * z);
             x           = x * l2_inv;
             y           = y * l2_inv;
             z           = z * l2_inv;
@@ -307,7 +310,8 @@ namespace pga
         {
             auto m2     = compute([](auto m) { return m * ~m; }, *this);
             auto u      = m2[0];
-            auto sqrt_u = std::sqrt(u);
+            using std::sqrt;
+            auto sqrt_u = sqrt(u);
             auto v      = m2[1];
             m2[0]       = T{1} / sqrt_u;
             m2[1]       = -v / (2 * sqrt_u * u);
@@ -324,10 +328,15 @@ namespace pga
             return data[index];
         }
 
-        // A closed-form solution of the logarithm of an element of the even subalgebra also exists
+        // The bivector whose exponential is this motor, which must be normalized (see op_log in
+        // expr.hpp). Rotation angles are recovered in [0, pi).
         GAL_NODISCARD constexpr auto log() const noexcept;
     };
 
+    // A motor asserted to satisfy m * ~m = 1 (see normalized)
+    template <typename T = float>
+    using normalized_motor = normalized<motor<T>>;
+
     template <typename T = float>
     union plane
     {
@@ -403,7 +412,7 @@ namespace pga
         // Like planes, points are represented dually as the intersection of three planes
         GAL_NODISCARD constexpr static mv<algebra_t, 3, 3, 3> ie(uint32_t id) noexcept
         {
-            return {mv_size{3, 4, 4},
+            return {mv_size{3, 3, 3},
                     {
                         ind{id + 2, one}, // -z
                         ind{id + 1, one}, // y
@@ -545,76 +554,127 @@ namespace pga
     template <typename T>
     constexpr auto motor<T>::log() const noexcept
     {
-        auto s1 = data[0]; // <m>_0
-        auto p1 = data[7]; // <m>_4
+        return compute([](auto m) { return ::gal::log(m); }, *this);
+    }
+
+    template <typename L, typename... Data>
+    auto compute(L lambda, Data const&... input)
+    {
+        return ::gal::detail::compute<::gal::pga::pga_algebra>(lambda, input...);
+    }
 
-        auto l = bivector();
+    template <typename... Free, typename L, typename... Bound>
+    auto bind(L lambda, Bound const&... bound)
+    {
+        return ::gal::detail::bind<::gal::pga::pga_algebra, Free...>(lambda, bound...);
+    }
 
-        // s2 + p2 * I
-        auto l2 = compute([](auto l) { return (l | l) + (l ^ l); }, l);
-        auto s2 = std::sqrt(-l2.template select<0>());
-        auto p2 = -l2.template select<0b1111>() / (2 * s2);
+    template <typename L, typename O, typename... Data>
+    void compute_batch(L lambda, O const& out, Data const&... input)
+    {
+        ::gal::detail::compute_batch<::gal::pga::pga_algebra>(lambda, out, input...);
+    }
 
-        entity<pga_algebra, T, 0, 0b1111> inv_norm{T{1} / s2, p2 / l2.template select<0>()};
+    template <typename X, typename L, typename O, typename... Data>
+    void parallel_compute(X& executor, L lambda, O const& out, Data const&... input)
+    {
+        ::gal::detail::parallel_compute<::gal::pga::pga_algebra>(executor, lambda, out, input...);
+    }
 
-        bool s1_zero = std::abs(s1) < T{1e-6};
-        scalar<pga_algebra, T> u{s1_zero ? ::std::atan2(-p1, p2) : ::std::atan2(s2, s1)};
-        scalar<pga_algebra, T> v{s1_zero ? -p1 / s2 : p2 / s1};
+    template <typename... Data>
+    using evaluate = ::gal::detail::evaluate<gal::pga::pga_algebra, Data...>;
 
-        return compute(
-            [](auto u, auto v, auto l, auto inv_norm) { return (u + v * 1_ps) * l * inv_norm; },
-            u,
-            v,
-            l,
-            inv_norm);
+    // Converts a motor to the row-major rigid transform [R|t] acting on column vectors (R = 4
+    // appends the row 0 0 0 1). The columns of R are the images of the planes e1, e2 and e3 and t is
+    // the image of the origin, so only the components of the sandwich products which are kept get
+    // evaluated. A motor m yields |m|^2 [R|t], so the motor is expected to be normalized.
+    //
+    // Besides motors, M may be any entity of the even subalgebra (a rotor or translator) or an
+    // aosoa_block of motors, in which case a matrix of simd entries is produced.
+    template <size_t R = 3, typename M>
+    GAL_NODISCARD auto to_matrix(M const& m) noexcept
+    {
+        static_assert(R == 3 || R == 4, "Rigid transforms are converted to 3x4 or 4x4 matrices");
+
+        auto [x, y, z, o] = compute(
+            [](auto m) {
+                return gal::tuple{m * 1_e1 * ~m, m * 1_e2 * ~m, m * 1_e3 * ~m, m * 1_e123 * ~m};
+            },
+            m);
+
+        // The origin maps to -t_x e023 + t_y e013 - t_z e012 + e123
+        using V = typename M::value_t;
+        matrix<V, R, 4> out{{x.template select<0b10>(),
+                             y.template select<0b10>(),
+                             z.template select<0b10>(),
+                             -o.template select<0b1101>(),
+                             x.template select<0b100>(),
+                             y.template select<0b100>(),
+                             z.template select<0b100>(),
+                             o.template select<0b1011>(),
+                             x.template select<0b1000>(),
+                             y.template select<0b1000>(),
+                             z.template select<0b1000>(),
+                             -o.template select<0b111>()}};
+        if constexpr (R == 4)
+        {
+            out(3, 3) = V(1);
+        }
+        return out;
     }
 
-    // Given a motor, compute the closed form logarithm
+    // Converts a span of motors to a span of 3x4 or 4x4 matrices of the same size, evaluating
+    // batch_width<T> conversions at once over SIMD lanes
+    template <typename O, typename I>
+    void to_matrix(span<O> out, span<I> in) noexcept
+    {
+        ::gal::detail::convert_batch(
+            [](auto const& lanes) { return to_matrix<O::rows()>(lanes); }, out, in);
+    }
 
-    /* TODO: This function requires two argument transcendentals and conditional branching
-    template <typename T>
-    constexpr auto log(T m) noexcept
-    {
-        // When normalized, the motor has the form <m>_0 + <m>_2 + <m>_4
-        // m := s1 + L + p1 * I
-        // Decompose L into L = (s2 + p2 * I) * L_norm => m = s1 + p1 * I + (s2 + p2 * I) * L_norm
-        //
-        // The norm is computed as above with norm = sqrt(-s2) - p2/(2 * sqrt(-s2)) * I
-        // so norm_inv is 1/sqrt(-s2) - p2 / (2 * s2 * sqrt(-s2)) * I
-        //
-        // The exponential has the form:
-        //
-        // (cosu - vsinu * I) + (sinu + vcosu * I) * L_norm = e^((u + v*I) * L_norm)
-        //
-        // Comparing the two equations leads to:
-        //
-        // s1 = cosu
-        // p2 = vcosu
-        // s2 = sinu
-        // p1 = -vsinu
-        //
-        // If s1 isn't 0, we can solve for u as arctan(s2/s1) and v = p2/s1 using the first 2
-        // equations If s1 is 0, we take instead the second and fourth equation so u =
-        // arctan(-p2/p1) and v = -p1/s2
-        auto s1 = m[0];
-        auto p1 = m[0b1111];
-        auto l = m.select_grade(2);
-        auto l2_0 = l | l;
-        auto s2 = sqrt(-l2_0);
-        auto p2 = -((l ^ l)[0b1111]) / (2 * s2);
-
-        auto inv_norm = 1 / s2 + p2 / l2_0 * 1_e0123;
+    // Recovers the motor of a rigid transform [R|t] (the last row of a 4x4 matrix is ignored). R must
+    // be a rotation matrix.
+    template <typename T, size_t R>
+    GAL_NODISCARD motor<T> from_matrix(matrix<T, R, 4> const& m) noexcept
+    {
+        static_assert(R == 3 || R == 4, "Rigid transforms are converted from 3x4 or 4x4 matrices");
+
+        auto [w, x, y, z] = ::gal::detail::rotation_quaternion(m);
+
+        // The translation is applied after the rotation: m = (1 - t/2 e0) * r
+        entity<pga_algebra, T, 0, 0b11, 0b101, 0b1001> t{
+            T{1}, T{-0.5} * m(0, 3), T{-0.5} * m(1, 3), T{-0.5} * m(2, 3)};
+        entity<pga_algebra, T, 0, 0b110, 0b1010, 0b1100> r{w, -z, y, -x};
+        return compute([](auto t, auto r) { return t * r; }, t, r);
     }
-    */
 
-    template <typename L, typename... Data>
-    auto compute(L lambda, Data const&... input)
+    // Screw linear interpolation between normalized motors. The result moves along the screw
+    // motion carrying m0 to m1 at constant speed (m0 at t = 0 and m1 at t = 1, or -m1 when the
+    // two are of opposite sign). The whole chain reduces to a single kernel, so it may also be
+    // passed to compute_batch or parallel_compute.
+    //
+    // m1 and -m1 are the same rigid transform, but the logarithm of ~m0 * m1 diverges as its
+    // scalar part tends to -1 (see motor<T>::log). The relative motor is therefore multiplied by
+    // the sign of its scalar part, which takes the shorter arc and aligns keyframes stored with
+    // flipped signs without a branch per channel.
+    constexpr inline auto interpolation = [](auto m0, auto m1, auto t) {
+        auto relative = ~m0 * m1;
+        return m0 * exp(t * log(sign(relative[0]) * relative));
+    };
+
+    template <typename T>
+    GAL_NODISCARD motor<T> interpolate(motor<T> const& m0, motor<T> const& m1, T t) noexcept
     {
-        return ::gal::detail::compute<::gal::pga::pga_algebra>(lambda, input...);
+        return compute(interpolation, m0, m1, t);
     }
 
-    template <typename... Data>
-    using evaluate = ::gal::detail::evaluate<gal::pga::pga_algebra, Data...>;
+    // Interpolates many channels at once over SIMD lanes (see compute_batch). Each of m0, m1 and t
+    // is either a view holding an element per output or a single value shared by all outputs.
+    template <typename O, typename M0, typename M1, typename S>
+    void interpolate(O const& out, M0 const& m0, M1 const& m1, S const& t) noexcept
+    {
+        compute_batch(interpolation, out, m0, m1, t);
+    }
 } // namespace pga
 
 namespace detail
@@ -264,6 +264,24 @@ namespace pga2
         return ::gal::detail::compute<::gal::pga2::pga2_algebra>(lambda, input...);
     }
 
+    template <typename... Free, typename L, typename... Bound>
+    auto bind(L lambda, Bound const&... bound)
+    {
+        return ::gal::detail::bind<::gal::pga2::pga2_algebra, Free...>(lambda, bound...);
+    }
+
+    template <typename L, typename O, typename... Data>
+    void compute_batch(L lambda, O const& out, Data const&... input)
+    {
+        ::gal::detail::compute_batch<::gal::pga2::pga2_algebra>(lambda, out, input...);
+    }
+
+    template <typename X, typename L, typename O, typename... Data>
+    void parallel_compute(X& executor, L lambda, O const& out, Data const&... input)
+    {
+        ::gal::detail::parallel_compute<::gal::pga2::pga2_algebra>(executor, lambda, out, input...);
+    }
+
     template <typename... Data>
     using evaluate = ::gal::detail::evaluate<gal::pga2::pga2_algebra, Data...>;
 } // namespace pga2
@@ -0,0 +1,1636 @@
+#pragma once
+
+// runtime.hpp
+// Evaluation of expressions that are only known at runtime (e.g. transforms composed by a user in
+// a tool). The expression is built with the same operators and reduced with the same routines as
+// the compile-time path (rpn_reshape for common subexpression extraction and the symbolic
+// product/sum of algebra.hpp), but the reduction happens once, when a program is constructed. The
+// reduced multivectors are then lowered to a flat register bytecode executed by a small
+// interpreter loop, optionally over SIMD lanes to amortize dispatch across many inputs.
+//
+// All storage has a fixed capacity (see the macros below); exceeding a capacity produces an invalid
+// program rather than undefined behavior. The symbolic reduction runs in a runtime::workspace,
+// which is several hundred kilobytes with the default capacities and is therefore never placed on
+// the stack: either supply one or let the program use a thread_local instance. A program itself
+// holds its bytecode inline (roughly 18 KB), and evaluation uses GAL_RUNTIME_REGISTER_CAPACITY
+// values (or SIMD lanes of values) of stack. This header is opt-in and nothing else in GAL depends
+// on it.
+
+#include "dfa.hpp"
+#include "entity.hpp"
+#include "simd.hpp"
+#include "span.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#ifndef GAL_RUNTIME_NODE_CAPACITY
+// Maximum number of nodes in a runtime expression
+#    define GAL_RUNTIME_NODE_CAPACITY 256
+#endif
+
+#ifndef GAL_RUNTIME_INPUT_CAPACITY
+// Maximum number of inputs a runtime context may declare
+#    define GAL_RUNTIME_INPUT_CAPACITY 16
+#endif
+
+#ifndef GAL_RUNTIME_MON_CAPACITY
+// Minimum monomial capacity of each intermediate multivector during reduction. The capacity is
+// raised to the square of the number of basis elements so that the product of two extracted
+// temporaries always fits.
+#    define GAL_RUNTIME_MON_CAPACITY 256
+#endif
+
+#ifndef GAL_RUNTIME_STACK_CAPACITY
+// Maximum depth of the argument stack during reduction. Each entry of the stack is a
+// multivector of the monomial capacity, making it the largest part of a runtime::workspace.
+#    define GAL_RUNTIME_STACK_CAPACITY 8
+#endif
+
+#ifndef GAL_RUNTIME_TEMP_CAPACITY
+// Maximum number of extracted common subexpressions
+#    define GAL_RUNTIME_TEMP_CAPACITY 64
+#endif
+
+#ifndef GAL_RUNTIME_INSTRUCTION_CAPACITY
+#    define GAL_RUNTIME_INSTRUCTION_CAPACITY 2048
+#endif
+
+#ifndef GAL_RUNTIME_CONSTANT_CAPACITY
+#    define GAL_RUNTIME_CONSTANT_CAPACITY 128
+#endif
+
+#ifndef GAL_RUNTIME_REGISTER_CAPACITY
+#    define GAL_RUNTIME_REGISTER_CAPACITY 512
+#endif
+
+namespace gal
+{
+namespace runtime
+{
+    enum class status : uint8_t
+    {
+        ok,
+        expression_overflow, // The expression exceeded GAL_RUNTIME_NODE_CAPACITY
+        input_overflow,      // Too many inputs were declared
+        symbolic_overflow,   // An intermediate multivector or the argument stack overflowed
+        unsupported,         // Division by a quantity that is not a single monomial
+        program_overflow,    // Instruction, constant, or register capacity exceeded
+    };
+
+    inline namespace GAL_RATIONAL_ABI
+    {
+        // An expression built at runtime. Expressions support the same operators as the
+        // compile-time expressions passed to compute lambdas, so generic lambdas may be invoked
+        // with runtime expressions directly.
+        template <typename A>
+        struct expr
+        {
+            using algebra_t = A;
+
+            detail::rpne<A, GAL_RUNTIME_NODE_CAPACITY> rpn{};
+            // Set if this expression (or any expression it was built from) exceeded the capacity
+            bool overflow = false;
+
+            expr() noexcept = default;
+
+            template <width_t S>
+            expr(detail::rpne<A, S> const& in) noexcept
+            {
+                if (in.count > GAL_RUNTIME_NODE_CAPACITY)
+                {
+                    overflow = true;
+                    return;
+                }
+                rpn.append(in);
+                rpn.q = in.q;
+            }
+
+            expr(detail::rpne_constant c) noexcept
+                : expr{c.template convert<A>()}
+            {}
+
+            GAL_NODISCARD expr operator[](elem_t e) const noexcept
+            {
+                auto in = rpn;
+                return make(in[e], overflow);
+            }
+
+            GAL_NODISCARD expr select_grade(elem_t g) const noexcept
+            {
+                auto in = rpn;
+                return make(in.select_grade(g), overflow);
+            }
+
+            GAL_NODISCARD friend expr operator+(expr const& lhs, expr const& rhs) noexcept
+            {
+                return make(lhs.rpn + rhs.rpn, lhs.overflow || rhs.overflow);
+            }
+
+            GAL_NODISCARD friend expr operator-(expr const& lhs, expr const& rhs) noexcept
+            {
+                return make(lhs.rpn - rhs.rpn, lhs.overflow || rhs.overflow);
+            }
+
+            GAL_NODISCARD friend expr operator*(expr const& lhs, expr const& rhs) noexcept
+            {
+                return make(lhs.rpn * rhs.rpn, lhs.overflow || rhs.overflow);
+            }
+
+            GAL_NODISCARD friend expr operator/(expr const& lhs, expr const& rhs) noexcept
+            {
+                return make(lhs.rpn / rhs.rpn, lhs.overflow || rhs.overflow);
+            }
+
+            GAL_NODISCARD friend expr operator^(expr const& lhs, expr const& rhs) noexcept
+            {
+                return make(lhs.rpn ^ rhs.rpn, lhs.overflow || rhs.overflow);
+            }
+
+            GAL_NODISCARD friend expr operator&(expr const& lhs, expr const& rhs) noexcept
+            {
+                return make(lhs.rpn & rhs.rpn, lhs.overflow || rhs.overflow);
+            }
+
+            GAL_NODISCARD friend expr operator|(expr const& lhs, expr const& rhs) noexcept
+            {
+                return make(lhs.rpn | rhs.rpn, lhs.overflow || rhs.overflow);
+            }
+
+            GAL_NODISCARD friend expr operator>>(expr const& lhs, expr const& rhs) noexcept
+            {
+                return make(lhs.rpn >> rhs.rpn, lhs.overflow || rhs.overflow);
+            }
+
+            GAL_NODISCARD friend expr operator%(expr const& lhs, expr const& rhs) noexcept
+            {
+                return make(lhs.rpn % rhs.rpn, lhs.overflow || rhs.overflow);
+            }
+
+            GAL_NODISCARD friend expr operator*(int n, expr const& rhs) noexcept
+            {
+                return make(n * rhs.rpn, rhs.overflow);
+            }
+
+            GAL_NODISCARD friend expr operator/(expr const& lhs, int d) noexcept
+            {
+                return make(lhs.rpn / d, lhs.overflow);
+            }
+
+            GAL_NODISCARD friend expr operator/(int n, expr const& rhs) noexcept
+            {
+                return make(n / rhs.rpn, rhs.overflow);
+            }
+
+            GAL_NODISCARD friend expr operator+(int n, expr const& rhs) noexcept
+            {
+                return make(n + rhs.rpn, rhs.overflow);
+            }
+
+            GAL_NODISCARD friend expr operator+(expr const& lhs, int n) noexcept
+            {
+                return make(lhs.rpn + n, lhs.overflow);
+            }
+
+            GAL_NODISCARD friend expr operator-(int n, expr const& rhs) noexcept
+            {
+                return make(n - rhs.rpn, rhs.overflow);
+            }
+
+            GAL_NODISCARD friend expr operator-(expr const& lhs, int n) noexcept
+            {
+                return make(lhs.rpn - n, lhs.overflow);
+            }
+
+            GAL_NODISCARD friend expr operator-(expr const& in) noexcept
+            {
+                return make(-in.rpn, in.overflow);
+            }
+
+            GAL_NODISCARD friend expr operator~(expr const& in) noexcept
+            {
+                return make(~in.rpn, in.overflow);
+            }
+
+            GAL_NODISCARD friend expr operator!(expr const& in) noexcept
+            {
+                return make(!in.rpn, in.overflow);
+            }
+
+            GAL_NODISCARD friend expr sqrt(expr const& in) noexcept
+            {
+                return make(::gal::sqrt(in.rpn), in.overflow);
+            }
+
+            GAL_NODISCARD friend expr sin(expr const& in) noexcept
+            {
+                return make(::gal::sin(in.rpn), in.overflow);
+            }
+
+            GAL_NODISCARD friend expr cos(expr const& in) noexcept
+            {
+                return make(::gal::cos(in.rpn), in.overflow);
+            }
+
+            GAL_NODISCARD friend expr tan(expr const& in) noexcept
+            {
+                return make(::gal::tan(in.rpn), in.overflow);
+            }
+
+            GAL_NODISCARD friend expr sign(expr const& in) noexcept
+            {
+                return make(::gal::sign(in.rpn), in.overflow);
+            }
+
+            GAL_NODISCARD friend expr exp(expr const& in) noexcept
+            {
+                return make(::gal::exp(in.rpn), in.overflow);
+            }
+
+            GAL_NODISCARD friend expr log(expr const& in) noexcept
+            {
+                return make(::gal::log(in.rpn), in.overflow);
+            }
+
+            GAL_NODISCARD friend expr scalar_product(expr const& lhs, expr const& rhs) noexcept
+            {
+                return make(::gal::scalar_product(lhs.rpn, rhs.rpn), lhs.overflow || rhs.overflow);
+            }
+
+        private:
+            template <width_t S>
+            static expr make(detail::rpne<A, S> const& in, bool failed) noexcept
+            {
+                expr out{in};
+                out.overflow = out.overflow || failed;
+                return out;
+            }
+        };
+
+        // Declares the inputs of runtime expressions. Inputs are identified in declaration order,
+        // and their values are laid out consecutively (component-wise) when a program is evaluated.
+        template <typename A>
+        struct context
+        {
+            using input_ie_t = mv<A, 64, 64, (1 << A::metric_t::dimension)>;
+
+            std::array<input_ie_t, GAL_RUNTIME_INPUT_CAPACITY> ies_{};
+            width_t input_count_ = 0;
+            width_t id_count_    = 0;
+            bool overflow_       = false;
+
+            // Returns an expression referring to a new input of type E (an entity or a scalar)
+            template <typename E>
+            GAL_NODISCARD expr<A> input() noexcept
+            {
+                expr<A> out;
+                if (input_count_ == GAL_RUNTIME_INPUT_CAPACITY)
+                {
+                    overflow_    = true;
+                    out.overflow = true;
+                    return out;
+                }
+
+                auto ie = input_ie<E>(static_cast<uint32_t>(id_count_));
+                static_assert(decltype(ie)::ind_capacity() <= input_ie_t::ind_capacity()
+                                  && decltype(ie)::mon_capacity() <= input_ie_t::mon_capacity(),
+                              "Input entity is too large for a runtime context");
+                ies_[input_count_]
+                    = ie.template resize<input_ie_t::ind_capacity(),
+                                         input_ie_t::mon_capacity(),
+                                         input_ie_t::term_capacity()>();
+
+                out.rpn.append(
+                    detail::node{detail::op_id, static_cast<uint32_t>(id_count_), input_count_});
+                ++input_count_;
+                if constexpr (detail::is_field_v<E>)
+                {
+                    id_count_ += 1;
+                }
+                else
+                {
+                    id_count_ += E::size();
+                }
+                return out;
+            }
+
+            // Number of values a program built from this context consumes per evaluation
+            GAL_NODISCARD size_t input_size() const noexcept
+            {
+                return id_count_;
+            }
+
+        private:
+            // Mirrors rpn_inputs
+            template <typename E>
+            GAL_NODISCARD static auto input_ie(uint32_t id) noexcept
+            {
+                if constexpr (detail::is_field_v<E>)
+                {
+                    return mv<A, 1, 1, 1>{
+                        mv_size{1, 1, 1}, {ind{id, one}}, {mon{one, one, 1, 0}}, {term{1, 0, 0}}};
+                }
+                else if constexpr (!std::is_same_v<typename E::algebra_t, A>)
+                {
+                    return E::ie(A{}, id);
+                }
+                else
+                {
+                    return E::ie(id);
+                }
+            }
+        };
+    } // namespace GAL_RATIONAL_ABI
+} // namespace runtime
+
+namespace detail
+{
+    enum class rt_opcode : uint8_t
+    {
+        mov, // dst = lhs
+        add, // dst = lhs + rhs
+        sub, // dst = lhs - rhs
+        mul, // dst = lhs * rhs
+        div, // dst = lhs / rhs
+        fma, // dst = dst + lhs * rhs
+        pow, // dst = pow(lhs, rhs)
+        sqrt,
+        sin,
+        cos,
+        tan,
+        sign,
+        exp, // dst, dst + 1, dst + 2 = exp_closed(lhs)
+        log, // dst, dst + 1 = log_closed(lhs)
+    };
+
+    struct rt_instruction
+    {
+        rt_opcode op;
+        uint16_t dst;
+        uint16_t lhs;
+        uint16_t rhs;
+    };
+
+    // During lowering, the final position of constants, scratch values, and outputs in the register
+    // file is not yet known. Registers are tagged with their kind in the upper two bits and
+    // resolved once lowering completes.
+    enum rt_register : uint16_t
+    {
+        rt_reg_id       = 0,
+        rt_reg_constant = 1 << 14,
+        rt_reg_scratch  = 2 << 14,
+        rt_reg_output   = 3 << 14,
+        rt_reg_kind     = 3 << 14,
+        rt_reg_index    = (1 << 14) - 1,
+    };
+
+    // The register file is laid out as follows:
+    // [0, input_size)                inputs (in context declaration order)
+    // [input_size, constant_base)    common subexpressions
+    // [constant_base, scratch_base)  constants
+    // [scratch_base, output_base)    scratch values
+    // [output_base, register_count)  output terms
+    template <typename A>
+    struct rt_code
+    {
+        std::array<rt_instruction, GAL_RUNTIME_INSTRUCTION_CAPACITY> instructions;
+        std::array<double, GAL_RUNTIME_CONSTANT_CAPACITY> constants;
+        std::array<uint32_t, (1 << A::metric_t::dimension)> elements;
+        width_t instruction_count = 0;
+        width_t constant_count    = 0;
+        width_t input_size        = 0;
+        width_t constant_base     = 0;
+        width_t output_base       = 0;
+        width_t output_size       = 0;
+        width_t register_count    = 0;
+    };
+
+    template <typename A>
+    constexpr inline width_t rt_term_capacity = 1 << A::metric_t::dimension;
+
+    template <typename A>
+    constexpr inline width_t rt_mon_capacity
+        = rt_term_capacity<A> * rt_term_capacity<A> > GAL_RUNTIME_MON_CAPACITY
+              ? rt_term_capacity<A> * rt_term_capacity<A>
+              : GAL_RUNTIME_MON_CAPACITY;
+
+    template <typename A>
+    using rt_mv = mv<A, 2 * rt_mon_capacity<A>, rt_mon_capacity<A>, rt_term_capacity<A>>;
+
+    // Storage for a product prior to collation
+    template <typename A>
+    struct rt_scratch
+    {
+        std::array<ind, 2 * rt_mon_capacity<A>> inds;
+        std::array<mon_view, rt_mon_capacity<A>> mons;
+        std::array<term, rt_term_capacity<A> * rt_term_capacity<A>> terms;
+        rt_mv<A> collated;
+    };
+
+    // Copies a multivector of any capacity into a runtime multivector if its contents fit
+    template <typename A, width_t I, width_t M, width_t T>
+    GAL_NODISCARD bool rt_assign(rt_mv<A>& out, mv<A, I, M, T> const& in) noexcept
+    {
+        if (in.size.ind > 2 * rt_mon_capacity<A> || in.size.mon > rt_mon_capacity<A>
+            || in.size.term > rt_term_capacity<A>)
+        {
+            return false;
+        }
+
+        out.size = in.size;
+        for (width_t i = 0; i != in.size.ind; ++i)
+        {
+            out.inds[i] = in.inds[i];
+        }
+        for (width_t i = 0; i != in.size.mon; ++i)
+        {
+            out.mons[i] = in.mons[i];
+        }
+        for (width_t i = 0; i != in.size.term; ++i)
+        {
+            out.terms[i] = in.terms[i];
+        }
+        out.o = in.o;
+        return true;
+    }
+
+    // Runtime counterpart of detail::product. The intermediate storage is bounded by the scratch
+    // capacity rather than by the (compile-time) capacities of the operands.
+    template <typename P, typename A>
+    GAL_NODISCARD bool rt_product(P,
+                                  rt_mv<A> const& lhs,
+                                  rt_mv<A> const& rhs,
+                                  rt_scratch<A>& scratch,
+                                  rt_mv<A>& out) noexcept
+    {
+        auto temp_inds_it  = scratch.inds.begin();
+        auto temp_mons_it  = scratch.mons.begin();
+        auto temp_terms_it = scratch.terms.begin();
+
+        for (auto lhs_it = lhs.cbegin(); lhs_it != lhs.cend(); ++lhs_it)
+        {
+            for (auto rhs_it = rhs.cbegin(); rhs_it != rhs.cend(); ++rhs_it)
+            {
+                auto&& [element, multiplier] = P::product(lhs_it->element, rhs_it->element);
+                if (multiplier == 0)
+                {
+                    continue;
+                }
+
+                auto mon_cursor = temp_mons_it;
+
+                for (auto lhs_mon = lhs_it.cbegin(); lhs_mon != lhs_it.cend(); ++lhs_mon)
+                {
+                    for (auto rhs_mon = rhs_it.cbegin(); rhs_mon != rhs_it.cend(); ++rhs_mon)
+                    {
+                        if (temp_mons_it == scratch.mons.end()
+                            || static_cast<width_t>(scratch.inds.end() - temp_inds_it)
+                                   < lhs_mon->count + rhs_mon->count)
+                        {
+                            return false;
+                        }
+
+                        // Merge the indeterminates of the lhs and rhs monomials.
+                        auto lhs_ind_it  = lhs_mon.cbegin();
+                        auto lhs_ind_end = lhs_mon.cend();
+                        auto rhs_ind_it  = rhs_mon.cbegin();
+                        auto rhs_ind_end = rhs_mon.cend();
+                        auto ind_cursor  = temp_inds_it;
+                        rat degree;
+
+                        while (lhs_ind_it != lhs_ind_end || rhs_ind_it != rhs_ind_end)
+                        {
+                            if (lhs_ind_it == lhs_ind_end || rhs_ind_it == rhs_ind_end)
+                            {
+                                bool lhs_done = lhs_ind_it == lhs_ind_end;
+                                auto& it      = lhs_done ? rhs_ind_it : lhs_ind_it;
+                                auto& it_end  = lhs_done ? rhs_ind_end : lhs_ind_end;
+                                for (; it != it_end; ++it)
+                                {
+                                    degree += it->degree;
+                                    *temp_inds_it++ = *it;
+                                }
+                            }
+                            else if (lhs_ind_it->id == rhs_ind_it->id)
+                            {
+                                rat next_degree = lhs_ind_it->degree + rhs_ind_it->degree;
+                                degree += next_degree;
+                                if (next_degree != 0)
+                                {
+                                    *temp_inds_it++ = ind{lhs_ind_it->id, next_degree};
+                                }
+                                ++lhs_ind_it;
+                                ++rhs_ind_it;
+                            }
+                            else if (lhs_ind_it->id < rhs_ind_it->id)
+                            {
+                                degree += lhs_ind_it->degree;
+                                *temp_inds_it++ = *lhs_ind_it++;
+                            }
+                            else
+                            {
+                                degree += rhs_ind_it->degree;
+                                *temp_inds_it++ = *rhs_ind_it++;
+                            }
+                        }
+
+                        *temp_mons_it++ = mon_view{
+                            mon{rat{multiplier * lhs_mon->q * rhs_mon->q},
+                                degree,
+                                static_cast<width_t>(temp_inds_it - ind_cursor),
+                                static_cast<width_t>(ind_cursor - scratch.inds.begin())},
+                            ind_cursor};
+                    }
+                }
+
+                *temp_terms_it++ = term{static_cast<width_t>(temp_mons_it - mon_cursor),
+                                        static_cast<width_t>(mon_cursor - scratch.mons.begin()),
+                                        element};
+            }
+        }
+
+        sort(scratch.terms.begin(), temp_terms_it);
+
+        collate(scratch.terms.begin(),
+                temp_terms_it,
+                scratch.mons.begin(),
+                scratch.inds.begin(),
+                scratch.collated.terms.begin(),
+                scratch.collated.mons.begin(),
+                scratch.collated.inds.begin(),
+                scratch.collated.size);
+        return rt_assign(out, scratch.collated);
+    }
+
+    template <typename A>
+    struct rt_temp
+    {
+        width_t id;
+        width_t count;
+        std::array<uint32_t, rt_term_capacity<A>> elements;
+    };
+
+    inline namespace GAL_RATIONAL_ABI
+    {
+        // Storage for the symbolic reduction. It is far too large for the stack (roughly 200 KB for
+        // PGA and 720 KB for CGA with the default capacities), so it is supplied to the compiler
+        // rather than owned by it. Every element is written before it is read, so a workspace may
+        // be reused across compilations without being cleared.
+        template <typename A>
+        struct rt_workspace
+        {
+            rpne<A, 3 * GAL_RUNTIME_NODE_CAPACITY> exp;
+            std::array<rt_mv<A>, GAL_RUNTIME_STACK_CAPACITY> args;
+            std::array<rt_temp<A>, GAL_RUNTIME_TEMP_CAPACITY> temps;
+            std::array<width_t, GAL_RUNTIME_TEMP_CAPACITY> cses;
+            rt_scratch<A> scratch;
+        };
+    } // namespace GAL_RATIONAL_ABI
+
+    // Performs the work of rpn_ctx (symbolic reduction of a reshaped expression) with the argument
+    // stack held in runtime storage, lowering each common subexpression and the final result to
+    // bytecode as they are encountered.
+    template <typename A>
+    struct rt_compiler
+    {
+        using poly_t = rt_mv<A>;
+        using temp_t = rt_temp<A>;
+
+        runtime::context<A> const& ctx;
+        rt_code<A>& code;
+        rpne<A, 3 * GAL_RUNTIME_NODE_CAPACITY>& exp;
+        std::array<poly_t, GAL_RUNTIME_STACK_CAPACITY>& args;
+        width_t arg_count = 0;
+        std::array<temp_t, GAL_RUNTIME_TEMP_CAPACITY>& temps;
+        width_t temp_count = 0;
+        // Temporaries spilled to bound intermediate sizes are interleaved with common
+        // subexpressions, so op_cse indices are mapped through this table
+        std::array<width_t, GAL_RUNTIME_TEMP_CAPACITY>& cses;
+        width_t cse_count = 0;
+        width_t id_count  = 0;
+        rt_scratch<A>& scratch;
+        runtime::status result = runtime::status::ok;
+
+        rt_compiler(runtime::context<A> const& c, rt_code<A>& out, rt_workspace<A>& ws) noexcept
+            : ctx{c}
+            , code{out}
+            , exp{ws.exp}
+            , args{ws.args}
+            , temps{ws.temps}
+            , cses{ws.cses}
+            , scratch{ws.scratch}
+        {}
+
+        void fail(runtime::status s) noexcept
+        {
+            if (result == runtime::status::ok)
+            {
+                result = s;
+            }
+        }
+
+        GAL_NODISCARD bool ok() const noexcept
+        {
+            return result == runtime::status::ok;
+        }
+
+        runtime::status compile(runtime::expr<A> const& e) noexcept
+        {
+            if (ctx.overflow_)
+            {
+                return runtime::status::input_overflow;
+            }
+            else if (e.overflow)
+            {
+                return runtime::status::expression_overflow;
+            }
+
+            exp      = rpn_reshape(e.rpn);
+            id_count = ctx.id_count_;
+            walk(0, exp.count);
+
+            if (ok() && arg_count > 1)
+            {
+                fail(runtime::status::unsupported);
+            }
+
+            if (ok() && arg_count == 1)
+            {
+                // The outermost scaling factor is applied when lowering the result
+                double scale = static_cast<double>(exp.q);
+                if constexpr (uses_null_basis<A>)
+                {
+                    lower_result(to_null_basis(args[0]), scale);
+                }
+                else
+                {
+                    lower_result(args[0], scale);
+                }
+            }
+
+            if (ok())
+            {
+                resolve();
+            }
+            return result;
+        }
+
+        poly_t* push() noexcept
+        {
+            if (arg_count == GAL_RUNTIME_STACK_CAPACITY)
+            {
+                fail(runtime::status::symbolic_overflow);
+                return nullptr;
+            }
+            return &args[arg_count++];
+        }
+
+        template <typename M>
+        void push(M const& in) noexcept
+        {
+            if (poly_t* top = push(); top && !rt_assign(*top, in))
+            {
+                fail(runtime::status::symbolic_overflow);
+            }
+        }
+
+        template <typename M>
+        void set(poly_t& out, M const& in) noexcept
+        {
+            if (!rt_assign(out, in))
+            {
+                fail(runtime::status::symbolic_overflow);
+            }
+        }
+
+        // Multiplies lhs by rhs in place. If the expanded product does not fit, both operands are
+        // first evaluated as temporaries, which bounds the product by the square of the term count.
+        template <typename P>
+        void multiply(P p, poly_t& lhs, poly_t& rhs) noexcept
+        {
+            if (rt_product(p, lhs, rhs, scratch, lhs))
+            {
+                return;
+            }
+
+            spill(lhs);
+            spill(rhs);
+            if (ok() && !rt_product(p, lhs, rhs, scratch, lhs))
+            {
+                fail(runtime::status::symbolic_overflow);
+            }
+        }
+
+        template <typename P>
+        void binary(P p) noexcept
+        {
+            // The lhs was pushed first
+            multiply(p, args[arg_count - 2], args[arg_count - 1]);
+            --arg_count;
+        }
+
+        void walk(width_t begin, width_t end) noexcept
+        {
+            for (width_t i = begin; i < end && ok();)
+            {
+                node const& n = exp.nodes[i];
+                switch (n.o)
+                {
+                case op_id:
+                    if constexpr (uses_null_basis<A>)
+                    {
+                        push(to_natural_basis(ctx.ies_[n.ex]));
+                    }
+                    else
+                    {
+                        push(ctx.ies_[n.ex]);
+                    }
+                    break;
+                case op_cse:
+                    if (poly_t* top = push())
+                    {
+                        create_ref(temps[cses[n.ex]], *top);
+                    }
+                    break;
+                case op_se: {
+                    // Evaluate up to the subexpression limit and push the result as an arg
+                    width_t base = arg_count;
+                    walk(i + 1, i + 1 + n.ex);
+                    if (!ok())
+                    {
+                        return;
+                    }
+                    if (arg_count - 1 != base)
+                    {
+                        args[base] = args[arg_count - 1];
+                    }
+                    arg_count = base + 1;
+                    if (n.q.num != 0)
+                    {
+                        // This is a summand, so apply the scaling factor
+                        args[base].scale(n.q);
+                    }
+                    i += 1 + n.ex;
+                    continue;
+                }
+                case op_noop:
+                    --arg_count;
+                    if (temp_count != GAL_RUNTIME_TEMP_CAPACITY)
+                    {
+                        cses[cse_count++] = temp_count;
+                    }
+                    extract_temp(args[arg_count]);
+                    break;
+                case op_rev:
+                    args[arg_count - 1] = reverse(args[arg_count - 1]);
+                    break;
+                case op_pd:
+                    args[arg_count - 1] = poincare_dual(args[arg_count - 1]);
+                    break;
+                case op_sum: {
+                    // Folded right-to-left as in rpn_ctx
+                    width_t base = arg_count - n.ex;
+                    for (width_t j = base + 1; j != arg_count && ok(); ++j)
+                    {
+                        accumulate(args[base], args[j]);
+                    }
+                    arg_count = base + 1;
+                    break;
+                }
+                case op_gp:
+                    binary(typename A::geometric{});
+                    break;
+                case op_ep: {
+                    width_t base = arg_count - n.ex;
+                    for (width_t j = arg_count - 1; j != base && ok(); --j)
+                    {
+                        multiply(typename A::exterior{}, args[j - 1], args[j]);
+                    }
+                    arg_count = base + 1;
+                    break;
+                }
+                case op_lc:
+                    binary(typename A::contract{});
+                    break;
+                case op_sip:
+                    binary(typename A::symmetric_inner{});
+                    break;
+                case op_div:
+                    divide(n.q);
+                    break;
+                case op_sqrt:
+                    args[arg_count - 1].sqrt(n.q);
+                    break;
+                case op_sin:
+                    args[arg_count - 1].sin(n.q);
+                    break;
+                case op_cos:
+                    args[arg_count - 1].cos(n.q);
+                    break;
+                case op_tan:
+                    args[arg_count - 1].tan(n.q);
+                    break;
+                case op_sign:
+                    args[arg_count - 1].sign(n.q);
+                    break;
+                case op_exp:
+                case op_log:
+                    closed_form(n);
+                    break;
+                case op_comp:
+                    set(args[arg_count - 1], args[arg_count - 1][static_cast<elem_t>(n.ex)]);
+                    break;
+                case op_grd:
+                    set(args[arg_count - 1],
+                        args[arg_count - 1].select_grade(static_cast<elem_t>(n.ex)));
+                    break;
+                case c_zero:
+                    push(mv<A, 0, 0, 0>{mv_size{0, 0, 0}, {}, {}, {}});
+                    break;
+                default:
+                    if (n.o < c_const_end)
+                    {
+                        push(mv<A, 1, 1, 1>{mv_size{1, 1, 1},
+                                            {ind{n.o - c_const_start + ind_constant_start, one}},
+                                            {mon{one, one, 1, 0}},
+                                            {term{1, 0, 0}}});
+                    }
+                    else
+                    {
+                        uint32_t g = n.o - c_scalar;
+                        push(mv<A, 0, 1, 1>{
+                            mv_size{0, 1, 1}, {}, {mon{one, zero, 0, 0}}, {term{1, 0, g}}});
+                    }
+                    break;
+                }
+                ++i;
+            }
+        }
+
+        void create_ref(temp_t const& temp, poly_t& out) noexcept
+        {
+            out.size = mv_size{temp.count, temp.count, temp.count};
+            out.o    = mv_op::id;
+            for (width_t i = 0; i != temp.count; ++i)
+            {
+                out.inds[i]  = ind{temp.id + i, one};
+                out.mons[i]  = mon{one, one, 1, i};
+                out.terms[i] = term{1, i, temp.elements[i]};
+            }
+        }
+
+        // Adds in to acc
+        void accumulate(poly_t& acc, poly_t& in) noexcept
+        {
+            if (!rt_assign(acc, sum(in, acc)))
+            {
+                spill(in);
+                spill(acc);
+                set(acc, sum(in, acc));
+            }
+        }
+
+        // Sets out to result k of a closed form whose results start at first (see closed_form in
+        // dfa.hpp for the values substituted when the argument vanishes)
+        void closed_value(poly_t& out, bool is_exp, bool is_zero, width_t first, width_t k) noexcept
+        {
+            if (!is_zero)
+            {
+                set(out,
+                    mv<A, 1, 1, 1>{mv_size{1, 1, 1},
+                                   {ind{first + k, one}},
+                                   {mon{one, one, 1, 0}},
+                                   {term{1, 0, 0}}});
+            }
+            else if (!is_exp && k == 0)
+            {
+                set(out,
+                    mv<A, 1, 1, 1>{mv_size{1, 1, 1},
+                                   {ind{ind_constant_start + c_pi - c_const_start, one}},
+                                   {mon{one_half, one, 1, 0}},
+                                   {term{1, 0, 0}}});
+            }
+            else
+            {
+                rat q = is_exp && k == 2 ? rat{-1, 3} : one;
+                set(out,
+                    mv<A, 0, 1, 1>{mv_size{0, 1, 1}, {}, {mon{q, zero, 0, 0}}, {term{1, 0, 0}}});
+            }
+        }
+
+        // Reifies exp or log of the top arg over the results of a single fused opcode (mirrors
+        // closed_form in dfa.hpp). Four stack slots above the argument hold intermediates.
+        void closed_form(node const& n) noexcept
+        {
+            constexpr elem_t ps = (1 << A::metric_t::dimension) - 1;
+            constexpr mv<A, 0, 1, 1> pseudoscalar{
+                mv_size{0, 1, 1}, {}, {mon{one, zero, 0, 0}}, {term{1, 0, ps}}};
+            bool const is_exp = n.o == op_exp;
+            width_t base      = arg_count - 1;
+            args[base].scale(n.q);
+
+            poly_t* p = push();
+            poly_t* x = push();
+            poly_t* t = push();
+            poly_t* u = push();
+            if (!u)
+            {
+                return;
+            }
+            poly_t& in = args[base];
+
+            // The argument is the negated scalar part of B^2 for exp, and the scalar part for log.
+            // The pseudoscalar coefficient is stashed in p (halved for exp).
+            *p = in;
+            if (is_exp)
+            {
+                *x = in;
+                multiply(typename A::geometric{}, *p, *x);
+            }
+            set(*x, (*p)[0]);
+            set(*p, (*p)[ps]);
+            if (is_exp)
+            {
+                x->scale(minus_one);
+                p->scale(one_half);
+            }
+
+            bool const is_zero = x->size.term == 0;
+            width_t first      = id_count;
+            if (!is_zero)
+            {
+                extract_temp(*x);
+                first = id_count;
+                if (first + 3 > rt_reg_index)
+                {
+                    fail(runtime::status::program_overflow);
+                    return;
+                }
+                emit(is_exp ? rt_opcode::exp : rt_opcode::log,
+                     static_cast<uint16_t>(first),
+                     static_cast<uint16_t>(first - 1));
+                id_count += is_exp ? 3 : 2;
+            }
+
+            if (is_exp)
+            {
+                // C + p/2 * S * I + S * B - p/2 * G * I * B
+                closed_value(*x, is_exp, is_zero, first, 0);
+                *t = *p;
+                closed_value(*u, is_exp, is_zero, first, 1);
+                multiply(typename A::geometric{}, *t, *u);
+                set(*u, pseudoscalar);
+                multiply(typename A::geometric{}, *t, *u);
+                accumulate(*x, *t);
+                closed_value(*t, is_exp, is_zero, first, 1);
+                multiply(typename A::geometric{}, *t, in);
+                accumulate(*x, *t);
+                closed_value(*u, is_exp, is_zero, first, 2);
+                multiply(typename A::geometric{}, *p, *u);
+                set(*t, pseudoscalar);
+                multiply(typename A::geometric{}, *t, in);
+                multiply(typename A::geometric{}, *p, *t);
+                p->scale(minus_one);
+                accumulate(*x, *p);
+            }
+            else
+            {
+                // F * L - p * H * I * L
+                set(in, in.select_grade(2));
+                closed_value(*x, is_exp, is_zero, first, 0);
+                multiply(typename A::geometric{}, *x, in);
+                closed_value(*u, is_exp, is_zero, first, 1);
+                multiply(typename A::geometric{}, *p, *u);
+                set(*t, pseudoscalar);
+                multiply(typename A::geometric{}, *t, in);
+                multiply(typename A::geometric{}, *p, *t);
+                p->scale(minus_one);
+                accumulate(*x, *p);
+            }
+
+            args[base] = *x;
+            arg_count  = base + 1;
+        }
+
+        void divide(rat q) noexcept
+        {
+            poly_t& lhs       = args[arg_count - 2];
+            poly_t const& rhs = args[arg_count - 1];
+            --arg_count;
+
+            // As with the compile-time path, the divisor must reduce to a single monomial
+            if (rhs.size.term != 1 || rhs.size.mon != 1 || rhs.size.ind > 1)
+            {
+                fail(runtime::status::unsupported);
+            }
+            else if (rhs.size.ind == 0)
+            {
+                set(lhs, detail::divide(lhs, rhs.template resize<0, 1, 1>(), q));
+            }
+            else if (!rt_assign(lhs, detail::divide(lhs, rhs.template resize<1, 1, 1>(), q)))
+            {
+                // Dividing each monomial may append an indeterminate, so retry with the dividend
+                // evaluated as a temporary
+                spill(lhs);
+                set(lhs, detail::divide(lhs, rhs.template resize<1, 1, 1>(), q));
+            }
+        }
+
+        // Evaluates an arg as a temporary and replaces it with a reference to the result. Args that
+        // are already a single monomial per term are left untouched.
+        void spill(poly_t& arg) noexcept
+        {
+            if (!ok() || (arg.o == mv_op::id && arg.size.mon == arg.size.term))
+            {
+                return;
+            }
+
+            extract_temp(arg);
+            if (ok())
+            {
+                create_ref(temps[temp_count - 1], arg);
+            }
+        }
+
+        // Force an arg to be evaluated as a temporary
+        void extract_temp(poly_t const& arg) noexcept
+        {
+            if (temp_count == GAL_RUNTIME_TEMP_CAPACITY)
+            {
+                fail(runtime::status::symbolic_overflow);
+                return;
+            }
+
+            temp_t& temp = temps[temp_count++];
+            temp.id           = id_count;
+            temp.count        = arg.size.term;
+            for (width_t i = 0; i != arg.size.term; ++i)
+            {
+                temp.elements[i] = arg.terms[i].element;
+            }
+
+            if constexpr (uses_null_basis<A>)
+            {
+                lower(to_null_basis(arg), rt_reg_id, id_count, 1.0);
+            }
+            else
+            {
+                lower(arg, rt_reg_id, id_count, 1.0);
+            }
+            id_count += arg.size.term;
+        }
+
+        template <typename M>
+        void lower_result(M const& in, double scale) noexcept
+        {
+            if (in.size.term > rt_term_capacity<A>)
+            {
+                fail(runtime::status::symbolic_overflow);
+                return;
+            }
+
+            code.output_size = in.size.term;
+            for (width_t i = 0; i != in.size.term; ++i)
+            {
+                code.elements[i] = in.terms[i].element;
+            }
+            lower(in, rt_reg_output, 0, scale);
+        }
+
+        void emit(rt_opcode op, uint16_t dst, uint16_t lhs, uint16_t rhs = 0) noexcept
+        {
+            if (code.instruction_count == GAL_RUNTIME_INSTRUCTION_CAPACITY)
+            {
+                fail(runtime::status::program_overflow);
+                return;
+            }
+            code.instructions[code.instruction_count++] = rt_instruction{op, dst, lhs, rhs};
+        }
+
+        GAL_NODISCARD uint16_t constant(double value) noexcept
+        {
+            for (width_t i = 0; i != code.constant_count; ++i)
+            {
+                if (code.constants[i] == value)
+                {
+                    return static_cast<uint16_t>(rt_reg_constant | i);
+                }
+            }
+
+            if (code.constant_count == GAL_RUNTIME_CONSTANT_CAPACITY)
+            {
+                fail(runtime::status::program_overflow);
+                return rt_reg_constant;
+            }
+            code.constants[code.constant_count] = value;
+            return static_cast<uint16_t>(rt_reg_constant | code.constant_count++);
+        }
+
+        GAL_NODISCARD uint16_t value_register(width_t id) noexcept
+        {
+            if (id >= ind_constant_start)
+            {
+                return constant(ind_constants<double>[id - ind_constant_start]);
+            }
+            else if (id > rt_reg_index)
+            {
+                fail(runtime::status::program_overflow);
+                return rt_reg_id;
+            }
+            return static_cast<uint16_t>(id);
+        }
+
+        // Raises the value of x to the supplied degree, writing to target if any work is needed
+        GAL_NODISCARD uint16_t raise(uint16_t x, rat degree, uint16_t target) noexcept
+        {
+            if (degree.den != 1)
+            {
+                emit(rt_opcode::pow, target, x, constant(static_cast<double>(degree)));
+                return target;
+            }
+
+            num_t n = abs(degree.num);
+            if (n == 1)
+            {
+                if (degree.num > 0)
+                {
+                    return x;
+                }
+                emit(rt_opcode::div, target, constant(1.0), x);
+                return target;
+            }
+
+            emit(rt_opcode::mul, target, x, x);
+            for (num_t i = 2; i != n; ++i)
+            {
+                emit(rt_opcode::mul, target, target, x);
+            }
+            if (degree.num < 0)
+            {
+                emit(rt_opcode::div, target, constant(1.0), target);
+            }
+            return target;
+        }
+
+        // Emits the product of a monomial's indeterminates (excluding its coefficient)
+        template <typename M>
+        GAL_NODISCARD uint16_t factor(M const& in, mon const& m) noexcept
+        {
+            constexpr uint16_t product = rt_reg_scratch;
+            constexpr uint16_t power   = rt_reg_scratch | 1;
+
+            uint16_t out = product;
+            for (width_t k = m.ind_offset; k != m.ind_offset + m.count; ++k)
+            {
+                ind const& i = in.inds[k];
+                uint16_t x   = value_register(i.id);
+                if (k == m.ind_offset)
+                {
+                    out = raise(x, i.degree, product);
+                }
+                else
+                {
+                    emit(rt_opcode::mul, product, out, raise(x, i.degree, power));
+                    out = product;
+                }
+            }
+            return out;
+        }
+
+        GAL_NODISCARD static rt_opcode transcendental(mv_op o) noexcept
+        {
+            switch (o)
+            {
+            case mv_op::sin:
+                return rt_opcode::sin;
+            case mv_op::cos:
+                return rt_opcode::cos;
+            case mv_op::tan:
+                return rt_opcode::tan;
+            case mv_op::sqrt:
+                return rt_opcode::sqrt;
+            case mv_op::sign:
+                return rt_opcode::sign;
+            default:
+                return rt_opcode::mov;
+            }
+        }
+
+        GAL_NODISCARD static double apply(mv_op o, double in) noexcept
+        {
+            switch (o)
+            {
+            case mv_op::sin:
+                return std::sin(in);
+            case mv_op::cos:
+                return std::cos(in);
+            case mv_op::tan:
+                return std::tan(in);
+            case mv_op::sqrt:
+                return std::sqrt(in);
+            case mv_op::sign:
+                return std::copysign(1.0, in);
+            default:
+                return in;
+            }
+        }
+
+        // Emits instructions evaluating each term of a multivector into consecutive registers
+        // (mirrors cterm and cmon). The scale factor is applied to the evaluated terms.
+        template <typename M>
+        void lower(M const& in, rt_register kind, width_t offset, double scale) noexcept
+        {
+            constexpr uint16_t value = rt_reg_scratch;
+            constexpr uint16_t temp  = rt_reg_scratch | 1;
+            bool const id            = in.o == mv_op::id;
+
+            for (width_t t = 0; t != in.size.term && ok(); ++t)
+            {
+                if (offset + t > rt_reg_index)
+                {
+                    fail(runtime::status::program_overflow);
+                    return;
+                }
+
+                term const& tm = in.terms[t];
+                auto dst       = static_cast<uint16_t>(kind | (offset + t));
+                bool first     = true;
+
+                for (width_t k = tm.mon_offset; k != tm.mon_offset + tm.count; ++k)
+                {
+                    mon const& m = in.mons[k];
+                    double q     = static_cast<double>(m.q) * (id ? scale : 1.0);
+                    if (m.q.is_zero())
+                    {
+                        continue;
+                    }
+
+                    if (m.count == 0)
+                    {
+                        uint16_t c = constant(apply(in.o, q));
+                        emit(first ? rt_opcode::mov : rt_opcode::add, dst, first ? c : dst, c);
+                    }
+                    else if (id)
+                    {
+                        uint16_t v = factor(in, m);
+                        if (q == 1.0)
+                        {
+                            emit(first ? rt_opcode::mov : rt_opcode::add, dst, first ? v : dst, v);
+                        }
+                        else if (q == -1.0 && !first)
+                        {
+                            emit(rt_opcode::sub, dst, dst, v);
+                        }
+                        else
+                        {
+                            emit(first ? rt_opcode::mul : rt_opcode::fma, dst, v, constant(q));
+                        }
+                    }
+                    else
+                    {
+                        uint16_t v = factor(in, m);
+                        if (q != 1.0)
+                        {
+                            emit(rt_opcode::mul, value, v, constant(q));
+                            v = value;
+                        }
+
+                        if (first)
+                        {
+                            emit(transcendental(in.o), dst, v);
+                        }
+                        else
+                        {
+                            emit(transcendental(in.o), temp, v);
+                            emit(rt_opcode::add, dst, dst, temp);
+                        }
+                    }
+                    first = false;
+                }
+
+                if (first)
+                {
+                    emit(rt_opcode::mov, dst, constant(0.0));
+                }
+                else if (!id && scale != 1.0)
+                {
+                    emit(rt_opcode::mul, dst, dst, constant(scale));
+                }
+            }
+        }
+
+        // Assign final positions in the register file
+        void resolve() noexcept
+        {
+            code.input_size     = ctx.id_count_;
+            code.constant_base  = id_count;
+            width_t scratch     = id_count + code.constant_count;
+            code.output_base    = scratch + 2;
+            code.register_count = code.output_base + code.output_size;
+            if (code.register_count > GAL_RUNTIME_REGISTER_CAPACITY)
+            {
+                fail(runtime::status::program_overflow);
+                return;
+            }
+
+            auto map = [&](uint16_t r) {
+                width_t index = r & rt_reg_index;
+                switch (r & rt_reg_kind)
+                {
+                case rt_reg_constant:
+                    index += code.constant_base;
+                    break;
+                case rt_reg_scratch:
+                    index += scratch;
+                    break;
+                case rt_reg_output:
+                    index += code.output_base;
+                    break;
+                default:
+                    break;
+                }
+                return static_cast<uint16_t>(index);
+            };
+
+            for (width_t i = 0; i != code.instruction_count; ++i)
+            {
+                rt_instruction& in = code.instructions[i];
+                in.dst             = map(in.dst);
+                in.lhs             = map(in.lhs);
+                in.rhs             = map(in.rhs);
+            }
+        }
+    };
+
+    // Interpreter loop shared by the scalar and batched evaluation paths. Transcendentals are
+    // called unqualified so that SIMD lanes are found via argument dependent lookup.
+    template <typename V>
+    void rt_execute(rt_instruction const* begin, rt_instruction const* end, V* r) noexcept
+    {
+        using std::cos;
+        using std::pow;
+        using std::sin;
+        using std::sqrt;
+        using std::tan;
+
+        for (rt_instruction const* it = begin; it != end; ++it)
+        {
+            rt_instruction const in = *it;
+            switch (in.op)
+            {
+            case rt_opcode::mov:
+                r[in.dst] = r[in.lhs];
+                break;
+            case rt_opcode::add:
+                r[in.dst] = r[in.lhs] + r[in.rhs];
+                break;
+            case rt_opcode::sub:
+                r[in.dst] = r[in.lhs] - r[in.rhs];
+                break;
+            case rt_opcode::mul:
+                r[in.dst] = r[in.lhs] * r[in.rhs];
+                break;
+            case rt_opcode::div:
+                r[in.dst] = r[in.lhs] / r[in.rhs];
+                break;
+            case rt_opcode::fma:
+                r[in.dst] = r[in.dst] + r[in.lhs] * r[in.rhs];
+                break;
+            case rt_opcode::pow:
+                r[in.dst] = pow(r[in.lhs], r[in.rhs]);
+                break;
+            case rt_opcode::sqrt:
+                r[in.dst] = sqrt(r[in.lhs]);
+                break;
+            case rt_opcode::sin:
+                r[in.dst] = sin(r[in.lhs]);
+                break;
+            case rt_opcode::cos:
+                r[in.dst] = cos(r[in.lhs]);
+                break;
+            case rt_opcode::tan:
+                r[in.dst] = tan(r[in.lhs]);
+                break;
+            case rt_opcode::sign:
+                r[in.dst] = sign(r[in.lhs]);
+                break;
+            case rt_opcode::exp:
+                exp_closed(r[in.lhs], r[in.dst], r[in.dst + 1], r[in.dst + 2]);
+                break;
+            case rt_opcode::log:
+                log_closed(r[in.lhs], r[in.dst], r[in.dst + 1]);
+                break;
+            }
+        }
+    }
+} // namespace detail
+
+namespace runtime
+{
+    // Storage for constructing programs over the algebra A. Its size is governed by the capacity
+    // macros above; it should live in static or heap storage, not on the stack.
+    template <typename A>
+    using workspace = detail::rt_workspace<A>;
+
+    inline namespace GAL_RATIONAL_ABI
+    {
+        // A runtime expression reduced and lowered to bytecode. Construction is comparatively
+        // expensive (the full symbolic reduction runs once); evaluation only executes the bytecode.
+        //
+        // Inputs are supplied as a flat array of input_size() values (the components of each input
+        // declared by the context, in declaration order). Results are written as output_size()
+        // values, the coefficients of the basis elements reported by element().
+        template <typename A, typename T = float>
+        struct program
+        {
+            using algebra_t = A;
+            using value_t   = T;
+
+            // Number of elements evaluated together by the batched interpreter
+            constexpr static size_t lanes = 64 / sizeof(T);
+
+            // Reduces the expression in a workspace private to the calling thread, which persists
+            // for the lifetime of the thread
+            program(context<A> const& ctx, expr<A> const& e) noexcept
+                : program{ctx, e, thread_workspace()}
+            {}
+
+            // Reduces the expression in caller-supplied storage (e.g. to bound memory held by
+            // threads that construct programs only occasionally)
+            program(context<A> const& ctx, expr<A> const& e, workspace<A>& ws) noexcept
+            {
+                detail::rt_compiler<A> compiler{ctx, code_, ws};
+                status_ = compiler.compile(e);
+                if (status_ != runtime::status::ok)
+                {
+                    code_ = detail::rt_code<A>{};
+                    return;
+                }
+
+                for (width_t i = 0; i != code_.constant_count; ++i)
+                {
+                    constants_[i] = static_cast<T>(code_.constants[i]);
+                }
+            }
+
+            GAL_NODISCARD runtime::status status() const noexcept
+            {
+                return status_;
+            }
+
+            GAL_NODISCARD bool valid() const noexcept
+            {
+                return status_ == runtime::status::ok;
+            }
+
+            GAL_NODISCARD size_t input_size() const noexcept
+            {
+                return code_.input_size;
+            }
+
+            GAL_NODISCARD size_t output_size() const noexcept
+            {
+                return code_.output_size;
+            }
+
+            // Basis element of the i-th output value
+            GAL_NODISCARD uint32_t element(size_t i) const noexcept
+            {
+                return code_.elements[i];
+            }
+
+            GAL_NODISCARD size_t instruction_count() const noexcept
+            {
+                return code_.instruction_count;
+            }
+
+            // Returns the coefficient of basis element e among evaluated outputs (zero if absent)
+            GAL_NODISCARD T select(T const* output, uint32_t e) const noexcept
+            {
+                for (width_t i = 0; i != code_.output_size; ++i)
+                {
+                    if (code_.elements[i] == e)
+                    {
+                        return output[i];
+                    }
+                }
+                return T{0};
+            }
+
+            void evaluate(T const* input, T* output) const noexcept
+            {
+                T r[GAL_RUNTIME_REGISTER_CAPACITY];
+                for (width_t i = 0; i != code_.input_size; ++i)
+                {
+                    r[i] = input[i];
+                }
+                execute(r, output);
+            }
+
+            // Evaluates with inputs supplied as entities (or scalars) matching those declared
+            template <typename... Data>
+            void operator()(T* output, Data const&... input) const noexcept
+            {
+                T r[GAL_RUNTIME_REGISTER_CAPACITY];
+                T* it = r;
+                (flatten(it, input), ...);
+                execute(r, output);
+            }
+
+            // Evaluates count = output.size() / output_size() inputs stored consecutively, lanes
+            // elements at a time
+            void evaluate(span<T const> input, span<T> output) const noexcept
+            {
+                using V = simd<T, lanes>;
+
+                if (code_.output_size == 0)
+                {
+                    return;
+                }
+
+                size_t const count = output.size() / code_.output_size;
+                V r[GAL_RUNTIME_REGISTER_CAPACITY];
+                load_constants(r);
+
+                for (size_t offset = 0; offset < count; offset += lanes)
+                {
+                    size_t const active = count - offset < lanes ? count - offset : lanes;
+                    for (width_t i = 0; i != code_.input_size; ++i)
+                    {
+                        T const* in = input.data() + offset * code_.input_size + i;
+                        for (size_t l = 0; l != lanes; ++l)
+                        {
+                            // Inactive lanes repeat the final element
+                            r[i][l] = in[(l < active ? l : active - 1) * code_.input_size];
+                        }
+                    }
+
+                    detail::rt_execute(code_.instructions.data(),
+                                       code_.instructions.data() + code_.instruction_count,
+                                       r);
+
+                    for (width_t i = 0; i != code_.output_size; ++i)
+                    {
+                        T* out        = output.data() + offset * code_.output_size + i;
+                        V const& reg = r[code_.output_base + i];
+                        for (size_t l = 0; l != active; ++l)
+                        {
+                            out[l * code_.output_size] = reg[l];
+                        }
+                    }
+                }
+            }
+
+        private:
+            static workspace<A>& thread_workspace() noexcept
+            {
+                static thread_local workspace<A> ws;
+                return ws;
+            }
+
+            template <typename V>
+            void load_constants(V* r) const noexcept
+            {
+                for (width_t i = 0; i != code_.constant_count; ++i)
+                {
+                    r[code_.constant_base + i] = V{constants_[i]};
+                }
+            }
+
+            void execute(T* r, T* output) const noexcept
+            {
+                load_constants(r);
+                detail::rt_execute(code_.instructions.data(),
+                                   code_.instructions.data() + code_.instruction_count,
+                                   r);
+                for (width_t i = 0; i != code_.output_size; ++i)
+                {
+                    output[i] = r[code_.output_base + i];
+                }
+            }
+
+            template <typename D>
+            static void flatten(T*& out, D const& datum) noexcept
+            {
+                if constexpr (detail::is_field_v<D>)
+                {
+                    *out++ = datum;
+                }
+                else
+                {
+                    for (size_t i = 0; i != D::size(); ++i)
+                    {
+                        *out++ = datum[i];
+                    }
+                }
+            }
+
+            detail::rt_code<A> code_{};
+            std::array<T, GAL_RUNTIME_CONSTANT_CAPACITY> constants_{};
+            runtime::status status_ = runtime::status::ok;
+        };
+    } // namespace GAL_RATIONAL_ABI
+} // namespace runtime
+} // namespace gal
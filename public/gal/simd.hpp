@@ -0,0 +1,244 @@
+#pragma once
+
+#include "numeric.hpp"
+
+#include <cmath>
+#include <cstddef>
+
+namespace gal
+{
+namespace detail
+{
+    // Alignment of a bundle of lanes: its size rounded up to a power of two, so that bundles of
+    // any width (including the odd widths an aosoa_block may be given) are well-formed
+    [[nodiscard]] constexpr size_t simd_alignment(size_t bytes) noexcept
+    {
+        size_t alignment = 1;
+        while (alignment < bytes)
+        {
+            alignment *= 2;
+        }
+        return alignment;
+    }
+} // namespace detail
+
+// A fixed-width bundle of lanes usable as the value type of any entity. Every arithmetic operation
+// and transcendental is applied lane-wise, so a single compute invocation over entities of
+// simd<float, 8> evaluates eight independent inputs at once (e.g. eight motors applied to eight
+// points). The lane loops are written plainly so they compile to vector instructions for whichever
+// instruction set the translation unit targets.
+template <typename T, size_t N>
+struct simd
+{
+    static_assert(std::is_floating_point_v<T>, "SIMD lanes must be floating-point values");
+
+    alignas(detail::simd_alignment(sizeof(T) * N)) T lanes[N];
+
+    GAL_NODISCARD constexpr static size_t size() noexcept
+    {
+        return N;
+    }
+
+    constexpr simd() noexcept = default;
+
+    // Broadcast a scalar to all lanes
+    constexpr simd(T value) noexcept
+        : lanes{}
+    {
+        for (size_t i = 0; i != N; ++i)
+        {
+            lanes[i] = value;
+        }
+    }
+
+    GAL_NODISCARD constexpr T const& operator[](size_t lane) const noexcept
+    {
+        return lanes[lane];
+    }
+
+    GAL_NODISCARD constexpr T& operator[](size_t lane) noexcept
+    {
+        return lanes[lane];
+    }
+
+    GAL_NODISCARD GAL_FORCE_INLINE constexpr simd operator-() const noexcept
+    {
+        simd out;
+        for (size_t i = 0; i != N; ++i)
+        {
+            out.lanes[i] = -lanes[i];
+        }
+        return out;
+    }
+
+    GAL_FORCE_INLINE constexpr simd& operator+=(simd const& other) noexcept
+    {
+        for (size_t i = 0; i != N; ++i)
+        {
+            lanes[i] += other.lanes[i];
+        }
+        return *this;
+    }
+
+    GAL_FORCE_INLINE constexpr simd& operator-=(simd const& other) noexcept
+    {
+        for (size_t i = 0; i != N; ++i)
+        {
+            lanes[i] -= other.lanes[i];
+        }
+        return *this;
+    }
+
+    GAL_FORCE_INLINE constexpr simd& operator*=(simd const& other) noexcept
+    {
+        for (size_t i = 0; i != N; ++i)
+        {
+            lanes[i] *= other.lanes[i];
+        }
+        return *this;
+    }
+
+    GAL_FORCE_INLINE constexpr simd& operator/=(simd const& other) noexcept
+    {
+        for (size_t i = 0; i != N; ++i)
+        {
+            lanes[i] /= other.lanes[i];
+        }
+        return *this;
+    }
+
+    // Operators are hidden friends so that scalars participating in an expression with lanes are
+    // broadcast implicitly.
+    GAL_NODISCARD GAL_FORCE_INLINE friend constexpr simd
+    operator+(simd lhs, simd const& rhs) noexcept
+    {
+        return lhs += rhs;
+    }
+
+    GAL_NODISCARD GAL_FORCE_INLINE friend constexpr simd
+    operator-(simd lhs, simd const& rhs) noexcept
+    {
+        return lhs -= rhs;
+    }
+
+    GAL_NODISCARD GAL_FORCE_INLINE friend constexpr simd
+    operator*(simd lhs, simd const& rhs) noexcept
+    {
+        return lhs *= rhs;
+    }
+
+    GAL_NODISCARD GAL_FORCE_INLINE friend constexpr simd
+    operator/(simd lhs, simd const& rhs) noexcept
+    {
+        return lhs /= rhs;
+    }
+
+    GAL_NODISCARD GAL_FORCE_INLINE friend simd sqrt(simd in) noexcept
+    {
+        for (size_t i = 0; i != N; ++i)
+        {
+            in.lanes[i] = std::sqrt(in.lanes[i]);
+        }
+        return in;
+    }
+
+    GAL_NODISCARD GAL_FORCE_INLINE friend simd sin(simd in) noexcept
+    {
+        for (size_t i = 0; i != N; ++i)
+        {
+            in.lanes[i] = std::sin(in.lanes[i]);
+        }
+        return in;
+    }
+
+    GAL_NODISCARD GAL_FORCE_INLINE friend simd cos(simd in) noexcept
+    {
+        for (size_t i = 0; i != N; ++i)
+        {
+            in.lanes[i] = std::cos(in.lanes[i]);
+        }
+        return in;
+    }
+
+    GAL_NODISCARD GAL_FORCE_INLINE friend simd sign(simd in) noexcept
+    {
+        for (size_t i = 0; i != N; ++i)
+        {
+            in.lanes[i] = std::copysign(T{1}, in.lanes[i]);
+        }
+        return in;
+    }
+
+    // Sine and cosine of every lane with one sincos call per lane (see closed_forms.hpp)
+    GAL_FORCE_INLINE friend void sincos(simd const& in, simd& s, simd& c) noexcept
+    {
+        for (size_t i = 0; i != N; ++i)
+        {
+            ::gal::sincos(in.lanes[i], s.lanes[i], c.lanes[i]);
+        }
+    }
+
+    // Closed forms of exp and log, without branches that would diverge between lanes (see
+    // closed_forms.hpp)
+    GAL_FORCE_INLINE friend void
+    exp_closed(simd const& in, simd& even, simd& odd, simd& dual) noexcept
+    {
+        for (size_t i = 0; i != N; ++i)
+        {
+            ::gal::exp_closed_branch_free(in.lanes[i], even.lanes[i], odd.lanes[i], dual.lanes[i]);
+        }
+    }
+
+    GAL_FORCE_INLINE friend void log_closed(simd const& in, simd& odd, simd& dual) noexcept
+    {
+        for (size_t i = 0; i != N; ++i)
+        {
+            ::gal::log_closed_branch_free(in.lanes[i], odd.lanes[i], dual.lanes[i]);
+        }
+    }
+
+    GAL_NODISCARD GAL_FORCE_INLINE friend simd tan(simd in) noexcept
+    {
+        for (size_t i = 0; i != N; ++i)
+        {
+            in.lanes[i] = std::tan(in.lanes[i]);
+        }
+        return in;
+    }
+
+    GAL_NODISCARD GAL_FORCE_INLINE friend simd pow(simd in, simd const& exponent) noexcept
+    {
+        for (size_t i = 0; i != N; ++i)
+        {
+            in.lanes[i] = std::pow(in.lanes[i], exponent.lanes[i]);
+        }
+        return in;
+    }
+
+    GAL_NODISCARD GAL_FORCE_INLINE friend simd abs(simd in) noexcept
+    {
+        for (size_t i = 0; i != N; ++i)
+        {
+            in.lanes[i] = std::abs(in.lanes[i]);
+        }
+        return in;
+    }
+};
+
+using float4  = simd<float, 4>;
+using float8  = simd<float, 8>;
+using float16 = simd<float, 16>;
+using double2 = simd<double, 2>;
+using double4 = simd<double, 4>;
+using double8 = simd<double, 8>;
+
+namespace detail
+{
+    template <typename T, size_t N>
+    struct field_traits<simd<T, N>>
+    {
+        constexpr static bool is_field = true;
+        using scalar_t                 = T;
+    };
+} // namespace detail
+} // namespace gal
@@ -0,0 +1,295 @@
+#pragma once
+
+#include "aosoa.hpp"
+#include "matrix.hpp"
+#include "pga.hpp"
+#include "span.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+// Forward kinematics of joint hierarchies. The world motor of a joint is the world motor of its
+// parent composed with the joint's local motor, a serial dependency along every chain. Joints of
+// equal depth are independent however, so the hierarchy is evaluated one level at a time with each
+// level packed into SIMD lanes (and optionally split across an executor). Many skeletons (a crowd)
+// may be evaluated as a single hierarchy, in which case every level spans all of them.
+//
+// No storage is allocated: the order in which joints are visited is written to a span supplied by
+// the caller, and the number of levels is bounded by GAL_SKELETON_DEPTH_CAPACITY. A hierarchy
+// exceeding it, or whose parent indices are not in topological order, produces an invalid
+// skeleton which evaluates nothing.
+
+#ifndef GAL_SKELETON_DEPTH_CAPACITY
+// Maximum number of joints along any path from a root joint
+#    define GAL_SKELETON_DEPTH_CAPACITY 64
+#endif
+
+namespace gal
+{
+namespace pga
+{
+    class skeleton
+    {
+    public:
+        // Parent index of root joints
+        constexpr static int32_t root = -1;
+
+        // Every parent index must either be root or less than the index of the joint itself. The
+        // order span must hold at least as many elements as the parents span and outlive the
+        // skeleton.
+        skeleton(span<int32_t const> parents, span<uint32_t> order) noexcept
+            : parents_{parents}
+            , order_{order}
+        {
+            if (order.size() < parents.size())
+            {
+                return;
+            }
+
+            // Joints are bucketed by depth. Depths are recomputed by walking up the hierarchy
+            // rather than stored, so no storage besides the order is needed.
+            std::array<uint32_t, GAL_SKELETON_DEPTH_CAPACITY + 1> counts{};
+            size_t levels = 0;
+            for (size_t i = 0; i != parents.size(); ++i)
+            {
+                int32_t parent = parents[i];
+                if (parent < root || parent >= static_cast<int32_t>(i))
+                {
+                    return;
+                }
+
+                size_t depth = depth_of(i);
+                if (depth == GAL_SKELETON_DEPTH_CAPACITY)
+                {
+                    return;
+                }
+                levels = std::max(levels, depth + 1);
+                ++counts[depth];
+            }
+
+            for (size_t d = 0; d != levels; ++d)
+            {
+                levels_[d + 1] = levels_[d] + counts[d];
+            }
+
+            // Within a level, joints are visited in index order
+            counts = levels_;
+            for (size_t i = 0; i != parents.size(); ++i)
+            {
+                order[counts[depth_of(i)]++] = static_cast<uint32_t>(i);
+            }
+            depth_ = levels;
+            valid_ = true;
+        }
+
+        GAL_NODISCARD bool valid() const noexcept
+        {
+            return valid_;
+        }
+
+        GAL_NODISCARD size_t size() const noexcept
+        {
+            return parents_.size();
+        }
+
+        // Number of levels (the number of joints along the longest chain, 0 if invalid)
+        GAL_NODISCARD size_t depth() const noexcept
+        {
+            return depth_;
+        }
+
+        GAL_NODISCARD span<int32_t const> parents() const noexcept
+        {
+            return parents_;
+        }
+
+        // Indices of the joints at the given depth, in ascending order (level 0 holds the roots)
+        GAL_NODISCARD span<uint32_t const> level(size_t depth) const noexcept
+        {
+            return {order_.data() + levels_[depth], levels_[depth + 1] - levels_[depth]};
+        }
+
+        // Computes the world motor of every joint from its local motor. Root joints are composed
+        // with the root motor (for example, the placement of the whole skeleton).
+        template <typename T, typename L>
+        void forward_kinematics(span<motor<T>> world,
+                                span<L> local,
+                                motor<T> const& root_motor = identity<T>()) const noexcept
+        {
+            for (size_t d = 0; d != depth_; ++d)
+            {
+                evaluate_level(
+                    d, world, span<matrix<T, 0, 4>>{}, local, root_motor, 0, level(d).size());
+            }
+        }
+
+        // As above, additionally converting each world motor to a 3x4 or 4x4 matrix (see
+        // to_matrix) while its level is evaluated
+        template <typename T, size_t R, typename L>
+        void forward_kinematics(span<motor<T>> world,
+                                span<matrix<T, R, 4>> matrices,
+                                span<L> local,
+                                motor<T> const& root_motor = identity<T>()) const noexcept
+        {
+            for (size_t d = 0; d != depth_; ++d)
+            {
+                evaluate_level(d, world, matrices, local, root_motor, 0, level(d).size());
+            }
+        }
+
+        // Splits each level into chunks evaluated by an executor (see parallel_compute). Levels
+        // narrower than a chunk are evaluated on the calling thread, as dispatching them would cost
+        // more than their evaluation.
+        template <typename X, typename T, typename L>
+        void parallel_forward_kinematics(X& executor,
+                                         span<motor<T>> world,
+                                         span<L> local,
+                                         motor<T> const& root_motor = identity<T>()) const
+        {
+            parallel_levels(executor, world, span<matrix<T, 0, 4>>{}, local, root_motor);
+        }
+
+        template <typename X, typename T, size_t R, typename L>
+        void parallel_forward_kinematics(X& executor,
+                                         span<motor<T>> world,
+                                         span<matrix<T, R, 4>> matrices,
+                                         span<L> local,
+                                         motor<T> const& root_motor = identity<T>()) const
+        {
+            parallel_levels(executor, world, matrices, local, root_motor);
+        }
+
+    private:
+        template <typename T>
+        GAL_NODISCARD constexpr static motor<T> identity() noexcept
+        {
+            return {T{1}, T{0}, T{0}, T{0}, T{0}, T{0}, T{0}, T{0}};
+        }
+
+        GAL_NODISCARD size_t depth_of(size_t joint) const noexcept
+        {
+            size_t depth   = 0;
+            int32_t parent = parents_[joint];
+            while (parent != root && depth != GAL_SKELETON_DEPTH_CAPACITY)
+            {
+                parent = parents_[parent];
+                ++depth;
+            }
+            return depth;
+        }
+
+        // Evaluates joints [first, first + count) of a level, batch_width<T> joints at a time.
+        // Unless R is 0 (for which matrices is empty), world motors are also converted to matrices
+        // of R rows.
+        template <typename T, size_t R, typename L>
+        void evaluate_level(size_t depth,
+                            span<motor<T>> world,
+                            span<matrix<T, R, 4>> matrices,
+                            span<L> local,
+                            motor<T> const& root_motor,
+                            size_t first,
+                            size_t count) const noexcept
+        {
+            constexpr size_t W = ::gal::detail::batch_width<T>;
+            using block_t      = aosoa_block<motor<T>, W>;
+
+            span<uint32_t const> joints = level(depth);
+            block_t parent_lanes;
+            block_t local_lanes;
+            if (depth == 0)
+            {
+                ::gal::detail::broadcast_lanes(parent_lanes, root_motor);
+            }
+
+            size_t const last = first + count;
+            for (size_t block = first; block < last; block += W)
+            {
+                size_t const lanes = std::min(W, last - block);
+
+                // Padding lanes replicate the last joint of the block
+                for (size_t lane = 0; lane != W; ++lane)
+                {
+                    uint32_t const joint = joints[block + std::min(lane, lanes - 1)];
+                    for (size_t i = 0; i != motor<T>::size(); ++i)
+                    {
+                        local_lanes[i][lane] = local[joint][i];
+                    }
+                    if (depth != 0)
+                    {
+                        motor<T> const& parent = world[parents_[joint]];
+                        for (size_t i = 0; i != motor<T>::size(); ++i)
+                        {
+                            parent_lanes[i][lane] = parent[i];
+                        }
+                    }
+                }
+
+                motor<simd<T, W>> result
+                    = compute([](auto parent, auto local) { return parent * local; },
+                              static_cast<block_t const&>(parent_lanes),
+                              static_cast<block_t const&>(local_lanes));
+                for (size_t lane = 0; lane != lanes; ++lane)
+                {
+                    motor<T>& out = world[joints[block + lane]];
+                    for (size_t i = 0; i != motor<T>::size(); ++i)
+                    {
+                        out[i] = result[i][lane];
+                    }
+                }
+
+                if constexpr (R != 0)
+                {
+                    auto transform = to_matrix<R>(result);
+                    for (size_t lane = 0; lane != lanes; ++lane)
+                    {
+                        auto& out = matrices[joints[block + lane]];
+                        for (size_t i = 0; i != out.size(); ++i)
+                        {
+                            out[i] = transform[i][lane];
+                        }
+                    }
+                }
+            }
+        }
+
+        template <typename X, typename T, size_t R, typename L>
+        void parallel_levels(X& executor,
+                             span<motor<T>> world,
+                             span<matrix<T, R, 4>> matrices,
+                             span<L> local,
+                             motor<T> const& root_motor) const
+        {
+            // A multiple of the batch width so that only the final chunk of a level is partial
+            constexpr size_t W     = ::gal::detail::batch_width<T>;
+            constexpr size_t grain = (256 + W - 1) / W * W;
+
+            for (size_t d = 0; d != depth_; ++d)
+            {
+                size_t const size = level(d).size();
+                if (size <= grain || executor.concurrency() == 1)
+                {
+                    evaluate_level(d, world, matrices, local, root_motor, 0, size);
+                    continue;
+                }
+
+                size_t const chunks = std::min((size + grain - 1) / grain, executor.concurrency());
+                size_t const target = (size + chunks - 1) / chunks;
+                size_t const chunk  = (target + W - 1) / W * W;
+                executor.parallel_for((size + chunk - 1) / chunk, [&](size_t index) {
+                    size_t const first = index * chunk;
+                    size_t const count = std::min(chunk, size - first);
+                    evaluate_level(d, world, matrices, local, root_motor, first, count);
+                });
+            }
+        }
+
+        span<int32_t const> parents_;
+        span<uint32_t> order_;
+        std::array<uint32_t, GAL_SKELETON_DEPTH_CAPACITY + 1> levels_{};
+        size_t depth_ = 0;
+        bool valid_   = false;
+    };
+} // namespace pga
+} // namespace gal
@@ -0,0 +1,213 @@
+#pragma once
+
+#include "aosoa.hpp"
+#include "pga.hpp"
+#include "span.hpp"
+#include "vga.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+// Linear blend skinning with motors. Every vertex is deformed by a weighted sum of the motors of up
+// to N joints. Unlike blended matrices, the blended motor is (after normalization) still a rigid
+// motion, so skinned limbs keep their volume at twisted joints (the PGA counterpart of dual
+// quaternion skinning).
+//
+// A blend m of motors is not normalized, but m * ~m = s + v e0123 for scalars s and v. As e0123
+// squares to zero and anticommutes with points and directions, sandwiching with the normalized
+// motor reduces to m * x * ~m / s. Both sandwich products and s are therefore evaluated as a single
+// kernel over SIMD lanes, which leaves a reciprocal per vertex in place of the square root and
+// pseudoscalar correction an explicit normalization requires.
+//
+// Like dual quaternions, the joint motors influencing a vertex should be sign-aligned (the scalar
+// parts of their pairwise products non-negative) for the blend to take the shorter arc.
+
+namespace gal
+{
+namespace pga
+{
+    // Joints deforming a vertex and their weights. Weights are relative as blends are normalized,
+    // and unused influences are given a weight of zero (the joint index must remain valid).
+    template <typename T = float, size_t N = 4>
+    struct skin_influences
+    {
+        std::array<uint32_t, N> joints;
+        std::array<T, N> weights;
+
+        GAL_NODISCARD constexpr static size_t size() noexcept
+        {
+            return N;
+        }
+    };
+} // namespace pga
+
+namespace detail
+{
+    // Both sandwich products of a blended motor and the scalar part of its squared norm
+    constexpr inline auto skinning = [](auto m, auto p, auto n) {
+        return gal::tuple{m * p * ~m, m * n * ~m, (m * ~m)[0]};
+    };
+
+    constexpr inline auto skinning_positions
+        = [](auto m, auto p) { return gal::tuple{m * p * ~m, (m * ~m)[0]}; };
+
+    // The normal spans are only accessed if Normals is set (and are otherwise empty)
+    template <bool Normals, typename T, typename J, typename I, typename P, typename Q>
+    static void skin(span<::gal::vga::point<T>> out_positions,
+                     span<::gal::pga::vector<T>> out_normals,
+                     span<J> joints,
+                     span<I> influences,
+                     span<P> positions,
+                     span<Q> normals) noexcept
+    {
+        constexpr size_t N = std::remove_cv_t<I>::size();
+        constexpr size_t W = batch_width<T>;
+        using motor_t      = ::gal::pga::motor<T>;
+        constexpr size_t M = motor_t::size();
+
+        aosoa_block<motor_t, W> m;
+        aosoa_block<::gal::vga::point<T>, W> p;
+        aosoa_block<::gal::pga::vector<T>, W> n;
+
+        auto evaluate_block = [&](size_t first, auto count) {
+            // The blend is linear, so it is accumulated while gathering joint motors by index
+            // (vectorizing over the components of each motor) and transposed to lanes once
+            alignas(sizeof(T) * M) T blend[W][M];
+            for (size_t lane = 0; lane != W; ++lane)
+            {
+                // Padding lanes replicate the last vertex
+                auto const& influence = influences[first + std::min<size_t>(lane, count - 1)];
+                for (size_t i = 0; i != M; ++i)
+                {
+                    blend[lane][i] = T{0};
+                }
+                for (size_t k = 0; k != N; ++k)
+                {
+                    auto const& joint = joints[influence.joints[k]];
+                    for (size_t i = 0; i != M; ++i)
+                    {
+                        blend[lane][i] += influence.weights[k] * joint[i];
+                    }
+                }
+            }
+            for (size_t i = 0; i != M; ++i)
+            {
+                for (size_t lane = 0; lane != W; ++lane)
+                {
+                    m[i][lane] = blend[lane][i];
+                }
+            }
+
+            detail::gather_lanes<W>(p, positions, first, count);
+            auto const& blended = static_cast<decltype(m) const&>(m);
+            auto const& point   = static_cast<decltype(p) const&>(p);
+            auto result         = [&] {
+                if constexpr (Normals)
+                {
+                    detail::gather_lanes<W>(n, normals, first, count);
+                    return compute<::gal::pga::pga_algebra>(
+                        skinning, blended, point, static_cast<decltype(n) const&>(n));
+                }
+                else
+                {
+                    return compute<::gal::pga::pga_algebra>(skinning_positions, blended, point);
+                }
+            }();
+
+            // Homogenizing by s applies the normalization (the e123 weight of m * p * ~m is s)
+            auto const& position = std::get<0>(result);
+            auto const& s        = std::get<Normals ? 2 : 1>(result);
+            simd<T, W> const inv = simd<T, W>{T{1}} / s.template select<0>();
+            simd<T, W> const x   = -position.template select<0b1101>() * inv;
+            simd<T, W> const y   = position.template select<0b1011>() * inv;
+            simd<T, W> const z   = -position.template select<0b111>() * inv;
+            for (size_t lane = 0; lane != count; ++lane)
+            {
+                out_positions[first + lane] = {x[lane], y[lane], z[lane]};
+            }
+
+            if constexpr (Normals)
+            {
+                auto const& normal  = std::get<1>(result);
+                simd<T, W> const nx = -normal.template select<0b1101>() * inv;
+                simd<T, W> const ny = normal.template select<0b1011>() * inv;
+                simd<T, W> const nz = -normal.template select<0b111>() * inv;
+                for (size_t lane = 0; lane != count; ++lane)
+                {
+                    out_normals[first + lane] = {nx[lane], ny[lane], nz[lane]};
+                }
+            }
+        };
+
+        size_t const tail = out_positions.size() % W;
+        for (size_t first = 0; first != out_positions.size() - tail; first += W)
+        {
+            evaluate_block(first, std::integral_constant<size_t, W>{});
+        }
+        if (tail != 0)
+        {
+            evaluate_block(out_positions.size() - tail, tail);
+        }
+    }
+} // namespace detail
+
+namespace pga
+{
+    // Skins a mesh: each output position and normal is the corresponding input transformed by the
+    // normalized blend of the joint motors named by its influences. Positions and normals are
+    // evaluated batch_width<T> vertices at a time. All input spans must hold at least as many
+    // elements as the output spans.
+    template <typename T, typename J, typename I, typename P, typename Q>
+    void skin(span<::gal::vga::point<T>> out_positions,
+              span<vector<T>> out_normals,
+              span<J> joints,
+              span<I> influences,
+              span<P> positions,
+              span<Q> normals) noexcept
+    {
+        ::gal::detail::skin<true>(
+            out_positions, out_normals, joints, influences, positions, normals);
+    }
+
+    // Skins positions only (for example, for depth or shadow passes)
+    template <typename T, typename J, typename I, typename P>
+    void skin(span<::gal::vga::point<T>> out_positions,
+              span<J> joints,
+              span<I> influences,
+              span<P> positions) noexcept
+    {
+        ::gal::detail::skin<false>(out_positions,
+                                   span<vector<T>>{},
+                                   joints,
+                                   influences,
+                                   positions,
+                                   span<vector<T> const>{});
+    }
+
+    // Splits skinning into chunks evaluated by an executor (see parallel_compute). Chunks are a
+    // multiple of 64 vertices, so (provided the output storage is cache-line aligned) no two
+    // threads write to the same cache line of the outputs.
+    template <typename X, typename T, typename J, typename I, typename P, typename Q>
+    void parallel_skin(X& executor,
+                       span<::gal::vga::point<T>> out_positions,
+                       span<vector<T>> out_normals,
+                       span<J> joints,
+                       span<I> influences,
+                       span<P> positions,
+                       span<Q> normals)
+    {
+        ::gal::detail::parallel_chunks(
+            executor, out_positions.size(), 64, [&](size_t first, size_t count) {
+                skin(out_positions.subspan(first, count),
+                     out_normals.subspan(first, count),
+                     joints,
+                     influences.subspan(first, count),
+                     positions.subspan(first, count),
+                     normals.subspan(first, count));
+            });
+    }
+} // namespace pga
+} // namespace gal
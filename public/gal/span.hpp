@@ -0,0 +1,101 @@
+#pragma once
+
+#include "opt.hpp"
+
+#include <cstddef>
+#include <type_traits>
+
+namespace gal
+{
+// Minimal non-owning view over contiguous storage (std::span is only available as of C++20).
+// Batched entry points accept spans of entities as inputs and outputs. GAL never allocates, so the
+// storage itself is always owned by the caller.
+template <typename T>
+struct span
+{
+    using value_t = std::remove_cv_t<T>;
+
+    T* data_     = nullptr;
+    size_t size_ = 0;
+
+    constexpr span() noexcept = default;
+
+    constexpr span(T* data, size_t size) noexcept
+        : data_{data}
+        , size_{size}
+    {}
+
+    template <size_t N>
+    constexpr span(T (&data)[N]) noexcept
+        : data_{data}
+        , size_{N}
+    {}
+
+    // Any contiguous container exposing data() and size() (std::vector, std::array, etc.)
+    template <typename C,
+              typename = std::enable_if_t<
+                  std::is_convertible_v<decltype(std::declval<C&>().data()), T*>>>
+    constexpr span(C& container) noexcept
+        : data_{container.data()}
+        , size_{container.size()}
+    {}
+
+    GAL_NODISCARD constexpr T* data() const noexcept
+    {
+        return data_;
+    }
+
+    GAL_NODISCARD constexpr size_t size() const noexcept
+    {
+        return size_;
+    }
+
+    GAL_NODISCARD constexpr bool empty() const noexcept
+    {
+        return size_ == 0;
+    }
+
+    GAL_NODISCARD constexpr T* begin() const noexcept
+    {
+        return data_;
+    }
+
+    GAL_NODISCARD constexpr T* end() const noexcept
+    {
+        return data_ + size_;
+    }
+
+    GAL_NODISCARD constexpr T& operator[](size_t index) const noexcept
+    {
+        return data_[index];
+    }
+
+    GAL_NODISCARD constexpr span<T> subspan(size_t offset, size_t count) const noexcept
+    {
+        return {data_ + offset, count};
+    }
+};
+
+template <typename T>
+span(T*, size_t)->span<T>;
+
+template <typename T, size_t N>
+span(T (&)[N])->span<T>;
+
+template <typename C>
+span(C&)->span<std::remove_pointer_t<decltype(std::declval<C&>().data())>>;
+
+namespace detail
+{
+    template <typename T>
+    struct is_span : std::false_type
+    {};
+
+    template <typename T>
+    struct is_span<span<T>> : std::true_type
+    {};
+
+    template <typename T>
+    constexpr inline bool is_span_v = is_span<std::decay_t<T>>::value;
+} // namespace detail
+} // namespace gal
@@ -0,0 +1,186 @@
+#pragma once
+
+#include "opt.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <thread>
+
+#ifndef GAL_THREAD_POOL_CAPACITY
+// Maximum number of worker threads a pool may spawn (the calling thread always participates too)
+#    define GAL_THREAD_POOL_CAPACITY 127
+#endif
+
+// A minimal work-stealing pool used to execute batched computations in parallel (see
+// parallel_compute in the model namespaces). This header is opt-in; nothing else in GAL depends on
+// threads. Any other executor may be used in its place provided it exposes:
+//
+//     size_t concurrency() const;                  // Number of threads tasks may run on
+//     void parallel_for(size_t count, F const& f); // Invokes f(i) for i in [0, count), returns
+//                                                  // once every invocation has completed
+//
+// Workers are held in fixed-capacity storage; the pool itself performs no heap allocations beyond
+// those made by std::thread.
+
+namespace gal
+{
+struct thread_pool
+{
+    // By default, one worker per hardware thread besides the caller
+    GAL_NODISCARD static size_t default_thread_count() noexcept
+    {
+        size_t const hardware = std::thread::hardware_concurrency();
+        return hardware > 1 ? hardware - 1 : 0;
+    }
+
+    // Spawns thread_count workers in addition to the thread calling parallel_for
+    explicit thread_pool(size_t thread_count = default_thread_count())
+        : thread_count_{std::min<size_t>(thread_count, GAL_THREAD_POOL_CAPACITY)}
+    {
+        size_t i = 0;
+        try
+        {
+            for (; i != thread_count_; ++i)
+            {
+                threads_[i] = std::thread{[this, i] { worker_main(i + 1); }};
+            }
+        }
+        catch (...)
+        {
+            // The destructor will not run, and joinable threads would terminate on destruction
+            stop(i);
+            throw;
+        }
+    }
+
+    thread_pool(thread_pool const&) = delete;
+    thread_pool& operator=(thread_pool const&) = delete;
+
+    ~thread_pool() noexcept
+    {
+        stop(thread_count_);
+    }
+
+    GAL_NODISCARD size_t concurrency() const noexcept
+    {
+        return thread_count_ + 1;
+    }
+
+    // Invokes task(i) for every i in [0, count) and blocks until all invocations have completed.
+    // Each participating thread owns a contiguous range of task indices which it consumes in order
+    // (preserving locality); threads that exhaust their own range steal from the others. Must not
+    // be invoked concurrently, or from within a task.
+    template <typename F>
+    void parallel_for(size_t count, F const& task)
+    {
+        if (count == 0)
+        {
+            return;
+        }
+
+        size_t const participants = concurrency();
+        for (size_t i = 0; i != participants; ++i)
+        {
+            ranges_[i].next.store(count * i / participants, std::memory_order_relaxed);
+            ranges_[i].end = count * (i + 1) / participants;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock{mutex_};
+            job_ = [](void const* context, size_t index) {
+                (*static_cast<F const*>(context))(index);
+            };
+            context_ = &task;
+            pending_ = thread_count_;
+            ++generation_;
+        }
+        wake_.notify_all();
+
+        run(0);
+
+        std::unique_lock<std::mutex> lock{mutex_};
+        done_.wait(lock, [this] { return pending_ == 0; });
+    }
+
+private:
+    // Each range occupies its own cache line so claiming tasks never contends with neighbors
+    struct alignas(64) task_range
+    {
+        std::atomic<size_t> next{0};
+        size_t end = 0;
+    };
+
+    void run(size_t participant) noexcept
+    {
+        size_t const participants = concurrency();
+        for (size_t i = 0; i != participants; ++i)
+        {
+            // Start with the owned range, then visit every other range in turn
+            task_range& range = ranges_[(participant + i) % participants];
+            for (size_t index = range.next.fetch_add(1, std::memory_order_relaxed);
+                 index < range.end;
+                 index = range.next.fetch_add(1, std::memory_order_relaxed))
+            {
+                job_(context_, index);
+            }
+        }
+    }
+
+    // Stops the workers and joins the first count of them
+    void stop(size_t count) noexcept
+    {
+        {
+            std::lock_guard<std::mutex> lock{mutex_};
+            stop_ = true;
+        }
+        wake_.notify_all();
+        for (size_t i = 0; i != count; ++i)
+        {
+            threads_[i].join();
+        }
+    }
+
+    void worker_main(size_t participant) noexcept
+    {
+        size_t generation = 0;
+        while (true)
+        {
+            {
+                std::unique_lock<std::mutex> lock{mutex_};
+                wake_.wait(lock, [&] { return stop_ || generation_ != generation; });
+                if (stop_)
+                {
+                    return;
+                }
+                generation = generation_;
+            }
+
+            run(participant);
+
+            std::lock_guard<std::mutex> lock{mutex_};
+            if (--pending_ == 0)
+            {
+                done_.notify_one();
+            }
+        }
+    }
+
+    size_t thread_count_;
+    std::array<std::thread, GAL_THREAD_POOL_CAPACITY> threads_;
+    std::array<task_range, GAL_THREAD_POOL_CAPACITY + 1> ranges_;
+
+    void (*job_)(void const*, size_t) = nullptr;
+    void const* context_              = nullptr;
+
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::condition_variable done_;
+    size_t generation_ = 0;
+    size_t pending_    = 0;
+    bool stop_         = false;
+};
+} // namespace gal
@@ -3,6 +3,7 @@
 #include "engine.hpp"
 #include "entity.hpp"
 #include "geometric_algebra.hpp"
+#include "matrix.hpp"
 #include "pga.hpp"
 
 #include <cmath>
@@ -125,7 +126,8 @@ namespace vga
 
         void normalize() noexcept
         {
-            auto l2_inv = T{1} / std::sqrt(x * x + y * y + z * z);
+            using std::sqrt;
+            auto l2_inv = T{1} / sqrt(x * x + y * y + z * z);
             x           = x * l2_inv;
             y           = y * l2_inv;
             z           = z * l2_inv;
@@ -256,7 +258,8 @@ namespace vga
         // vectors of zero length. This is not checked for!
         void normalize() noexcept
         {
-            auto l2_inv = T{1} / std::sqrt(x * x + y * y + z * z);
+            using std::sqrt;
+            auto l2_inv = T{1} / sqrt(x * x + y * y + z * z);
             x           = x * l2_inv;
             y           = y * l2_inv;
             z           = z * l2_inv;
@@ -295,13 +298,85 @@ namespace vga
         }
     };
 
+    // A rotor whose axis is asserted to be normalized, so that r * ~r = 1 (see normalized)
+    template <typename T = float>
+    using normalized_rotor = normalized<rotor<T>>;
+
     template <typename L, typename... Data>
     auto compute(L lambda, Data const&... input)
     {
         return ::gal::detail::compute<::gal::vga::vga_algebra>(lambda, input...);
     }
 
+    template <typename... Free, typename L, typename... Bound>
+    auto bind(L lambda, Bound const&... bound)
+    {
+        return ::gal::detail::bind<::gal::vga::vga_algebra, Free...>(lambda, bound...);
+    }
+
+    template <typename L, typename O, typename... Data>
+    void compute_batch(L lambda, O const& out, Data const&... input)
+    {
+        ::gal::detail::compute_batch<::gal::vga::vga_algebra>(lambda, out, input...);
+    }
+
+    template <typename X, typename L, typename O, typename... Data>
+    void parallel_compute(X& executor, L lambda, O const& out, Data const&... input)
+    {
+        ::gal::detail::parallel_compute<::gal::vga::vga_algebra>(executor, lambda, out, input...);
+    }
+
     template <typename... Data>
     using evaluate = ::gal::detail::evaluate<gal::vga::vga_algebra, Data...>;
+
+    // Converts a rotor to a row-major 3x3 rotation matrix acting on column vectors. Column i is the
+    // image of the basis vector e_i. As with the PGA motor conversion, R may also be an aosoa_block
+    // of rotors.
+    template <typename R>
+    GAL_NODISCARD auto to_matrix(R const& r) noexcept
+    {
+        auto [x, y, z] = compute(
+            [](auto r) { return gal::tuple{r * 1_e0 * ~r, r * 1_e1 * ~r, r * 1_e2 * ~r}; }, r);
+
+        return matrix<typename R::value_t, 3, 3>{{x.template select<0b1>(),
+                                                  y.template select<0b1>(),
+                                                  z.template select<0b1>(),
+                                                  x.template select<0b10>(),
+                                                  y.template select<0b10>(),
+                                                  z.template select<0b10>(),
+                                                  x.template select<0b100>(),
+                                                  y.template select<0b100>(),
+                                                  z.template select<0b100>()}};
+    }
+
+    // Converts a span of rotors to a span of 3x3 matrices of the same size, evaluating
+    // batch_width<T> conversions at once over SIMD lanes
+    template <typename O, typename I>
+    void to_matrix(span<O> out, span<I> in) noexcept
+    {
+        ::gal::detail::convert_batch([](auto const& lanes) { return to_matrix(lanes); }, out, in);
+    }
+
+    // Recovers the rotor of a 3x3 rotation matrix. The identity yields a rotation of angle zero about
+    // the z-axis.
+    template <typename T>
+    GAL_NODISCARD rotor<T> from_matrix(matrix<T, 3, 3> const& m) noexcept
+    {
+        using std::sqrt;
+        auto [w, x, y, z] = ::gal::detail::rotation_quaternion(m);
+
+        rotor<T> out{T{0}, T{0}, T{0}, T{1}};
+        T sin_theta = sqrt(x * x + y * y + z * z);
+        if (sin_theta > T{0})
+        {
+            T inv_sin     = T{1} / sin_theta;
+            out.cos_theta = w;
+            out.sin_theta = sin_theta;
+            out.x         = x * inv_sin;
+            out.y         = y * inv_sin;
+            out.z         = z * inv_sin;
+        }
+        return out;
+    }
 } // namespace vga
 } // namespace gal
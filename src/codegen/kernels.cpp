@@ -0,0 +1,39 @@
+// Kernels generated for the gal_kernels library (see codegen.hpp). Each lambda is reduced once
+// when gal_codegen is built rather than in every translation unit that evaluates it.
+
+#include <gal/cga.hpp>
+#include <gal/codegen.hpp>
+#include <gal/pga.hpp>
+
+void gal_codegen_register(gal::codegen::registry& registry)
+{
+    {
+        using namespace gal::pga;
+
+        registry.add<pga_algebra, point<float>, motor<float>>(
+            "pga_motor_point", [](auto p, auto m) { return m * p * ~m; });
+
+        // The side relations of the unit motor are applied as they are by compute
+        registry.add<pga_algebra, point<float>, gal::normalized<motor<float>>>(
+            "pga_unit_motor_point", [](auto p, auto m) { return m * p * ~m; });
+
+        registry.add<pga_algebra, motor<float>, motor<float>>(
+            "pga_motor_compose", [](auto m1, auto m2) { return m1 * m2; });
+
+        // Rotation about the z-axis by the supplied angle
+        registry.add<pga_algebra, gal::scalar<pga_algebra, float>>(
+            "pga_rotor_z", [](auto angle) { return cos(angle / 2) + sin(angle / 2) * 1_e12; });
+
+        registry.add<pga_algebra, line<float>>("pga_line_exp", [](auto l) { return exp(l); });
+
+        registry.add<pga_algebra, motor<float>>("pga_motor_log", [](auto m) { return log(m); });
+    }
+
+    {
+        using namespace gal::cga;
+
+        // Line through two points
+        registry.add<cga_algebra, point<float>, point<float>>(
+            "cga_line", [](auto p1, auto p2) { return (p1 ^ p2 ^ 1_ni) >> 1_ips; });
+    }
+}
@@ -0,0 +1,23 @@
+#include <gal/codegen.hpp>
+
+#include <cstdio>
+
+// Usage: gal_codegen <output directory> <name>
+// Writes <name>.hpp and <name>.cpp containing the kernels registered by gal_codegen_register.
+int main(int argc, char const* argv[])
+{
+    if (argc != 3)
+    {
+        std::fprintf(stderr, "Usage: %s <output directory> <name>\n", argv[0]);
+        return 1;
+    }
+
+    gal::codegen::registry registry{argv[2]};
+    gal_codegen_register(registry);
+    if (!registry.write(argv[1]))
+    {
+        std::fprintf(stderr, "Failed to write %s to %s\n", argv[2], argv[1]);
+        return 1;
+    }
+    return 0;
+}
@@ -129,6 +129,69 @@ TEST_CASE("multivector-arithmetic")
     }
 }
 
+TEST_CASE("operation-counts")
+{
+    SUBCASE("motor-sandwich")
+    {
+        auto cost = evaluate<point<>, motor<>>::cost([](auto p, auto m) { return m * p * ~m; });
+        // Counts are constant expressions usable as budgets
+        static_assert(decltype(cost)::value.terms == 4);
+
+        op_count c = cost;
+        CHECK_EQ(c.mul, 83);
+        CHECK_EQ(c.add, 36);
+        CHECK_EQ(c.div, 0);
+        CHECK_EQ(c.temps, 0);
+    }
+
+    SUBCASE("scalar-input")
+    {
+        // Plain floating point inputs may precede other inputs
+        op_count c = evaluate<float, point<>>::cost([](auto s, auto p) { return s * p; });
+        CHECK_EQ(c.mul, 4);
+        CHECK_EQ(c.add, 0);
+        CHECK_EQ(c.terms, 4);
+    }
+
+    SUBCASE("transcendentals")
+    {
+        using S   = gal::scalar<algebra_t, float>;
+        auto cost = evaluate<S>::cost([](auto a) { return cos(a / 2) + sin(a / 2) * 1_e12; });
+
+        // The sine and cosine share their argument and are evaluated together
+        op_count c = cost;
+        CHECK_EQ(c.sincos, 1);
+        CHECK_EQ(c.sin, 0);
+        CHECK_EQ(c.cos, 0);
+        CHECK_EQ(c.div, 1);
+        CHECK_EQ(c.mul, 0);
+        CHECK_EQ(c.temps, 2);
+        CHECK_EQ(c.terms, 2);
+
+        // Different arguments are not paired
+        op_count d = evaluate<S>::cost([](auto a) { return cos(a) + sin(a / 2) * 1_e12; });
+        CHECK_EQ(d.sincos, 0);
+        CHECK_EQ(d.sin, 1);
+        CHECK_EQ(d.cos, 1);
+    }
+
+    SUBCASE("closed-forms")
+    {
+        // Each closed form is a single fused evaluation without divisions or square roots
+        op_count e = evaluate<gal::pga::line<>>::cost([](auto l) { return exp(l); });
+        CHECK_EQ(e.exp, 1);
+        CHECK_EQ(e.sqrt, 0);
+        CHECK_EQ(e.div, 0);
+        CHECK_EQ(e.sin + e.cos + e.sincos, 0);
+        CHECK_EQ(e.terms, 8);
+
+        op_count l = evaluate<gal::pga::motor<>>::cost([](auto m) { return log(m); });
+        CHECK_EQ(l.log, 1);
+        CHECK_EQ(l.div, 0);
+        CHECK_EQ(l.terms, 6);
+    }
+}
+
 struct sm
 {
     constexpr static elem_t dimension = 1;
@@ -243,6 +306,159 @@ TEST_CASE("polynomial-expansion")
         CHECK_EQ(m12.terms[0].count, 1);
         CHECK_EQ(m12.terms[0].mon_offset, 0);
     }
+
+    SUBCASE("horner-factorization")
+    {
+        // abc + abd + ae = a(b(c + d) + e)
+        constexpr mv<sa, 8, 3, 1> p{
+            mv_size{8, 3, 1},
+            {ind{0, 1}, ind{1, 1}, ind{2, 1}, // abc
+             ind{0, 1}, ind{1, 1}, ind{3, 1}, // abd
+             ind{0, 1}, ind{4, 1}},           // ae
+            {mon{one, rat{3}, 3, 0}, mon{one, rat{3}, 3, 3}, mon{one, rat{2}, 2, 6}},
+            {term{3, 0, 0}}};
+        auto h = gal::detail::factor<8, 3, gal::detail::horner_capacity(p), 1>(p);
+        using gal::detail::hnode_kind;
+
+        auto a = h.nodes[h.roots[0]];
+        REQUIRE_EQ(a.kind, hnode_kind::product);
+        CHECK_EQ(a.lhs, 0);
+
+        auto a_sum = h.nodes[a.rhs];
+        REQUIRE_EQ(a_sum.kind, hnode_kind::sum);
+        auto b = h.nodes[a_sum.lhs];
+        REQUIRE_EQ(b.kind, hnode_kind::product);
+        CHECK_EQ(b.lhs, 1);
+        CHECK_EQ(h.nodes[b.rhs].kind, hnode_kind::sum);
+
+        auto e = h.nodes[a_sum.rhs];
+        REQUIRE_EQ(e.kind, hnode_kind::leaf);
+        CHECK_EQ(h.mons[e.lhs].count, 1);
+        CHECK_EQ(h.inds[h.mons[e.lhs].ind_offset].id, 4);
+
+        // Each leaf retains only the indeterminate that was not factored out
+        CHECK_EQ(h.mon_count, 3);
+        CHECK_EQ(h.ind_count, 3);
+    }
+
+    SUBCASE("horner-repeated-indeterminate")
+    {
+        // aab + ac + d = a(ab + c) + d where a appears twice in the first monomial but divides
+        // only two monomials
+        constexpr mv<sa, 6, 3, 1> p{
+            mv_size{6, 3, 1},
+            {ind{0, 1}, ind{0, 1}, ind{1, 1}, // aab
+             ind{0, 1}, ind{2, 1},            // ac
+             ind{3, 1}},                      // d
+            {mon{one, rat{3}, 3, 0}, mon{one, rat{2}, 2, 3}, mon{one, one, 1, 5}},
+            {term{3, 0, 0}}};
+        auto h = gal::detail::factor<6, 3, gal::detail::horner_capacity(p), 1>(p);
+        using gal::detail::hnode_kind;
+
+        auto sum = h.nodes[h.roots[0]];
+        REQUIRE_EQ(sum.kind, hnode_kind::sum);
+        auto a = h.nodes[sum.lhs];
+        REQUIRE_EQ(a.kind, hnode_kind::product);
+        CHECK_EQ(a.lhs, 0);
+
+        auto d = h.nodes[sum.rhs];
+        REQUIRE_EQ(d.kind, hnode_kind::leaf);
+        CHECK_EQ(h.inds[h.mons[d.lhs].ind_offset].id, 3);
+        CHECK_EQ(h.mon_count, 3);
+    }
+
+    SUBCASE("cross-term-hoisting")
+    {
+        // The product ab is shared by the terms abc + d and abe + a^2
+        constexpr mv<sa, 8, 4, 2> p{
+            mv_size{8, 4, 2},
+            {ind{0, 1}, ind{1, 1}, ind{2, 1}, // abc
+             ind{3, 1},                       // d
+             ind{0, 1}, ind{1, 1}, ind{4, 1}, // abe
+             ind{0, 2}},                      // a^2
+            {mon{one, rat{3}, 3, 0},
+             mon{one, one, 1, 3},
+             mon{one, rat{3}, 3, 4},
+             mon{one, rat{2}, 1, 7}},
+            {term{2, 0, 0}, term{2, 2, 1}}};
+        auto h = gal::detail::hoist<gal::detail::hoist_table_size(p)>(p, 10);
+
+        // The square of a only appears in one term and is left in place
+        REQUIRE_EQ(h.count, 1);
+        CHECK_EQ(h.products[0].lhs, 0);
+        CHECK_EQ(h.products[0].rhs, 1);
+
+        for (width_t m : {0, 2})
+        {
+            CHECK_EQ(h.ie.mons[m].count, 2);
+            CHECK_EQ(h.ie.mons[m].degree, rat{2});
+            CHECK_EQ(h.ie.inds[h.ie.mons[m].ind_offset].id, 10);
+        }
+        CHECK_EQ(h.ie.inds[h.ie.mons[0].ind_offset + 1].id, 2);
+        CHECK_EQ(h.ie.inds[h.ie.mons[2].ind_offset + 1].id, 4);
+        CHECK_EQ(h.ie.mons[3].count, 1);
+
+        // Factoring abe + a^2 as a(be + a) leaves four multiplications either way (counting the
+        // hoisted product)
+        auto f = gal::detail::factor<8, 4, gal::detail::horner_capacity(p), 2>(p);
+        auto g = gal::detail::factor<8, 4, gal::detail::horner_capacity(p), 2>(h.ie);
+        CHECK_EQ(gal::detail::horner_cost(f), 4);
+        CHECK_EQ(gal::detail::horner_cost(g), 3);
+    }
+}
+
+TEST_CASE("side-relations")
+{
+    // s^2 + a^2 + b^2 - 1 = 0
+    constexpr mv<sa, 3, 4, 1> relations{mv_size{3, 4, 1},
+                                        {ind{0, 2}, ind{1, 2}, ind{2, 2}},
+                                        {mon{minus_one, zero, 0, 0},
+                                         mon{one, rat{2}, 1, 0},
+                                         mon{one, rat{2}, 1, 1},
+                                         mon{one, rat{2}, 1, 2}},
+                                        {term{4, 0, 0}}};
+
+    // The terms s^2 + a^2 + b^2 and c + s^2 - a^2 - b^2
+    constexpr mv<sa, 7, 7, 2> p{mv_size{7, 7, 2},
+                                {ind{0, 2},
+                                 ind{1, 2},
+                                 ind{2, 2},
+                                 ind{3, 1},
+                                 ind{0, 2},
+                                 ind{1, 2},
+                                 ind{2, 2}},
+                                {mon{one, rat{2}, 1, 0},
+                                 mon{one, rat{2}, 1, 1},
+                                 mon{one, rat{2}, 1, 2},
+                                 mon{one, one, 1, 3},
+                                 mon{one, rat{2}, 1, 4},
+                                 mon{minus_one, rat{2}, 1, 5},
+                                 mon{minus_one, rat{2}, 1, 6}},
+                                {term{3, 0, 0}, term{4, 3, 1}}};
+
+    SUBCASE("rewrite")
+    {
+        constexpr auto r = gal::detail::reduce_relations<false>(p, relations);
+
+        // The first term becomes 1 and the second c + 2s^2 - 1 (rewriting a^2 rather than s^2,
+        // which would leave 1 + c - 2a^2 - 2b^2)
+        REQUIRE_EQ(r.size.term, 2);
+        REQUIRE_EQ(r.terms[0].count, 1);
+        CHECK_EQ(r.mons[r.terms[0].mon_offset].count, 0);
+        CHECK_EQ(r.mons[r.terms[0].mon_offset].q, one);
+        CHECK_EQ(r.terms[1].count, 3);
+        CHECK_EQ(r.terms[1].element, 1);
+    }
+
+    SUBCASE("vanishing-terms")
+    {
+        // s^2 + a^2 + b^2 - 1 vanishes entirely, so the term is dropped unless it must be kept
+        constexpr auto shifted = gal::detail::shift(minus_one, p);
+        constexpr auto r       = gal::detail::reduce_relations<false>(shifted, relations);
+        constexpr auto kept    = gal::detail::reduce_relations<true>(shifted, relations);
+        CHECK_EQ(r.size.term, 1);
+        CHECK_EQ(kept.size.term, 2);
+    }
 }
 
 TEST_CASE("scalar-division")
@@ -252,4 +468,44 @@ TEST_CASE("scalar-division")
     auto m12 = gal::detail::divide(m1, m2, one);
 }
 
+TEST_CASE("rational-arithmetic")
+{
+    SUBCASE("exact-through-wide-intermediates")
+    {
+        // The unreduced products and sums below exceed 32 bits but reduce to small fractions
+        constexpr rat p = rat{46349, 46351} * rat{46351, 46349};
+        CHECK_EQ(p.num, 1);
+        CHECK_EQ(p.den, 1);
+
+        constexpr rat q = rat{1, 65521} * rat{65521, 2};
+        CHECK_EQ(q.num, 1);
+        CHECK_EQ(q.den, 2);
+
+        constexpr rat s = rat{1, 65521} + rat{65520, 65521};
+        CHECK_EQ(s.num, 1);
+        CHECK_EQ(s.den, 1);
+
+        rat r{65537, 3};
+        r *= rat{3, 65537};
+        CHECK(r.is_unit());
+        constexpr rat lhs{65537, 65539};
+        constexpr rat rhs{65539, 65541};
+        CHECK(lhs < rhs);
+        CHECK_EQ(one_half, (rat{2, 4}));
+    }
+
+    SUBCASE("fine-grained-coefficients")
+    {
+        constexpr rat p = rat{1, 4099} * rat{1, 4099};
+#if GAL_RATIONAL_BITS == 64
+        // Kept exact with 64-bit rationals
+        CHECK_EQ(p.num, 1);
+        CHECK_EQ(p.den, 4099 * 4099);
+#else
+        // Vanishingly small with respect to single precision, so flushed
+        CHECK(p.is_zero());
+#endif
+    }
+}
+
 TEST_SUITE_END();
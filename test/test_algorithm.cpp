@@ -132,6 +132,82 @@ TEST_CASE("sort")
         CHECK_EQ(a[7], 8);
         CHECK_EQ(a[8], 9);
     }
+
+    SUBCASE("nearly-sorted")
+    {
+        std::array<int, 64> a{};
+        for (int i = 0; i != 64; ++i)
+        {
+            a[i] = i;
+        }
+        gal::detail::swap(a[3], a[40]);
+        gal::detail::swap(a[17], a[18]);
+        gal::detail::swap(a[0], a[63]);
+        sort(a.begin(), a.end());
+
+        for (int i = 0; i != 64; ++i)
+        {
+            CHECK_EQ(a[i], i);
+        }
+    }
+
+    SUBCASE("duplicates")
+    {
+        std::array<int, 48> a{};
+        for (int i = 0; i != 48; ++i)
+        {
+            a[i] = (i * 7) % 5;
+        }
+        sort(a.begin(), a.end());
+
+        for (int i = 1; i != 48; ++i)
+        {
+            CHECK_LE(a[i - 1], a[i]);
+        }
+        CHECK_EQ(a[0], 0);
+        CHECK_EQ(a[47], 4);
+    }
+
+    SUBCASE("comparator")
+    {
+        std::array<int, 32> a{};
+        for (int i = 0; i != 32; ++i)
+        {
+            a[i] = (i * 13) % 32;
+        }
+        sort(a.begin(), a.end(), [](int lhs, int rhs) { return rhs < lhs; });
+
+        for (int i = 0; i != 32; ++i)
+        {
+            CHECK_EQ(a[i], 31 - i);
+        }
+    }
+
+    SUBCASE("heap-sort")
+    {
+        std::array<int, 9> a = {9, 2, 6, 4, 8, 5, 3, 1, 7};
+        auto less            = [](int lhs, int rhs) { return lhs < rhs; };
+        gal::detail::heap_sort(a.begin(), a.end(), less);
+
+        for (int i = 0; i != 9; ++i)
+        {
+            CHECK_EQ(a[i], i + 1);
+        }
+    }
+
+    SUBCASE("constexpr")
+    {
+        constexpr auto a = [] {
+            std::array<int, 40> out{};
+            for (int i = 0; i != 40; ++i)
+            {
+                out[i] = 39 - i;
+            }
+            sort(out.begin(), out.end());
+            return out;
+        }();
+        static_assert(a[0] == 0 && a[20] == 20 && a[39] == 39);
+    }
 }
 
 TEST_CASE("crc32")
@@ -0,0 +1,171 @@
+#include "test_util.hpp"
+
+#include <doctest/doctest.h>
+#include <gal/cga.hpp>
+#include <gal/pga.hpp>
+#include <gal_kernels.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+// The generated kernels mirror the operations performed by compute, so results are expected to
+// agree to within a few units in the last place (or exactly, absent differing contraction of
+// multiplies and adds).
+constexpr int64_t max_ulps = 4;
+
+inline int64_t ulp_distance(float lhs, float rhs)
+{
+    auto ordered = [](float f) {
+        int32_t i;
+        std::memcpy(&i, &f, sizeof(f));
+        return static_cast<int64_t>(i < 0 ? INT32_MIN - i : i);
+    };
+    int64_t distance = ordered(lhs) - ordered(rhs);
+    return distance < 0 ? -distance : distance;
+}
+
+template <typename E, size_t N>
+void check_kernel(E const& expected, float const* out, unsigned const (&elements)[N])
+{
+    for (size_t i = 0; i != N; ++i)
+    {
+        CHECK_LE(ulp_distance(out[i], expected.select(elements[i])), max_ulps);
+    }
+}
+
+TEST_SUITE_BEGIN("codegen");
+
+TEST_CASE("codegen-pga")
+{
+    using namespace gal::pga;
+
+    point<float> p{1.0f, -2.0f, 3.0f, 1.0f};
+    motor<float> m1{1.0f, 0.2f, -0.3f, 0.4f, 0.5f, 0.6f, -0.7f, 0.8f};
+    motor<float> m2{0.5f, -0.1f, 0.3f, 0.2f, -0.4f, 0.1f, 0.9f, -0.2f};
+
+    SUBCASE("motor-point")
+    {
+        float in[gal_kernels::pga_motor_point_input_size];
+        float out[gal_kernels::pga_motor_point_output_size];
+        for (size_t i = 0; i != 4; ++i)
+        {
+            in[i] = p[i];
+        }
+        for (size_t i = 0; i != 8; ++i)
+        {
+            in[4 + i] = m1[i];
+        }
+        gal_kernels::pga_motor_point(in, out);
+
+        auto const expected
+            = gal::pga::compute([](auto p, auto m) { return m * p * ~m; }, p, m1);
+        check_kernel(expected, out, gal_kernels::pga_motor_point_elements);
+    }
+
+    SUBCASE("unit-motor-point")
+    {
+        // Composition of a rotation and a translation, hence normalized
+        float c = std::cos(0.6f);
+        float s = std::sin(0.6f);
+        motor<float> r{c, 0.0f, 0.0f, s * 0.6f, 0.0f, -s * 0.8f, 0.0f, 0.0f};
+        motor<float> t{1.0f, -0.5f, 0.25f, 0.0f, -1.0f, 0.0f, 0.0f, 0.0f};
+        gal::normalized<motor<float>> nm{gal::pga::compute([](auto t, auto r) { return t * r; }, t, r)};
+
+        float in[gal_kernels::pga_unit_motor_point_input_size];
+        float out[gal_kernels::pga_unit_motor_point_output_size];
+        for (size_t i = 0; i != 4; ++i)
+        {
+            in[i] = p[i];
+        }
+        for (size_t i = 0; i != 8; ++i)
+        {
+            in[4 + i] = nm[i];
+        }
+        gal_kernels::pga_unit_motor_point(in, out);
+
+        auto const expected
+            = gal::pga::compute([](auto p, auto m) { return m * p * ~m; }, p, nm);
+        check_kernel(expected, out, gal_kernels::pga_unit_motor_point_elements);
+
+        // With the relations applied, the weight of the point is carried through unscaled
+        for (size_t i = 0; i != gal_kernels::pga_unit_motor_point_output_size; ++i)
+        {
+            if (gal_kernels::pga_unit_motor_point_elements[i] == 0b1110)
+            {
+                CHECK_EQ(out[i], p[3]);
+            }
+        }
+    }
+
+    SUBCASE("motor-compose")
+    {
+        float in[gal_kernels::pga_motor_compose_input_size];
+        float out[gal_kernels::pga_motor_compose_output_size];
+        for (size_t i = 0; i != 8; ++i)
+        {
+            in[i]     = m1[i];
+            in[8 + i] = m2[i];
+        }
+        gal_kernels::pga_motor_compose(in, out);
+
+        auto const expected
+            = gal::pga::compute([](auto m1, auto m2) { return m1 * m2; }, m1, m2);
+        check_kernel(expected, out, gal_kernels::pga_motor_compose_elements);
+    }
+
+    SUBCASE("rotor")
+    {
+        for (float angle : {0.0f, 0.3f, -2.1f})
+        {
+            float out[gal_kernels::pga_rotor_z_output_size];
+            gal_kernels::pga_rotor_z(&angle, out);
+
+            auto const expected = gal::pga::compute(
+                [](auto angle) { return cos(angle / 2) + sin(angle / 2) * 1_e12; },
+                gal::scalar<pga_algebra, float>{angle});
+            check_kernel(expected, out, gal_kernels::pga_rotor_z_elements);
+        }
+    }
+
+    SUBCASE("exp-log")
+    {
+        // Rotation angles that are moderate, small (where the series form of the dual term is
+        // selected), zero (a pure translation, where the closed forms reach their limits) and
+        // large (approaching the divergence of log at a half-turn)
+        for (line<float> l : {line<float>{0.1f, -0.4f, 0.3f, 1.0f, 2.0f, -0.5f},
+                              line<float>{1e-3f, -2e-3f, 5e-4f, 1.0f, 2.0f, -0.5f},
+                              line<float>{0.0f, 0.0f, 0.0f, 1.0f, 2.0f, 3.0f},
+                              line<float>{1.2f, -1.5f, 0.9f, 0.5f, -1.0f, 0.4f}})
+        {
+            float out[gal_kernels::pga_line_exp_output_size];
+            gal_kernels::pga_line_exp(l.data.data(), out);
+            auto const expected = gal::pga::compute([](auto l) { return exp(l); }, l);
+            check_kernel(expected, out, gal_kernels::pga_line_exp_elements);
+
+            motor<float> const m = expected;
+            float log_out[gal_kernels::pga_motor_log_output_size];
+            gal_kernels::pga_motor_log(m.data.data(), log_out);
+            check_kernel(gal::pga::compute([](auto m) { return log(m); }, m),
+                         log_out,
+                         gal_kernels::pga_motor_log_elements);
+        }
+    }
+}
+
+TEST_CASE("codegen-cga")
+{
+    using namespace gal::cga;
+
+    point<float> p1{200.0f, 0.0f, 680.0f};
+    point<float> p2{200.0f, 1.0f, 680.0f};
+    float in[gal_kernels::cga_line_input_size] = {p1[0], p1[1], p1[2], p2[0], p2[1], p2[2]};
+    float out[gal_kernels::cga_line_output_size];
+    gal_kernels::cga_line(in, out);
+
+    auto const expected
+        = gal::cga::compute([](auto p1, auto p2) { return (p1 ^ p2 ^ 1_ni) >> 1_ips; }, p1, p2);
+    check_kernel(expected, out, gal_kernels::cga_line_elements);
+}
+
+TEST_SUITE_END();
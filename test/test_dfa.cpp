@@ -316,6 +316,17 @@ TEST_CASE("variadic-return")
     CHECK_EQ(p2[3], 8);
 }
 
+TEST_CASE("variadic-return-shared-subexpressions")
+{
+    // The results of the tuple share the motor and its reversion
+    gal::pga::motor<> m{1, 0, 0, 0, 0, 0, 0, 0};
+    auto&& [x, y] = compute([](auto m) { return gal::tuple{m * 1_e1 * ~m, m * 1_e2 * ~m}; }, m);
+    CHECK_EQ(x.template select<0b10>(), 1);
+    CHECK_EQ(x.template select<0b100>(), 0);
+    CHECK_EQ(y.template select<0b10>(), 0);
+    CHECK_EQ(y.template select<0b100>(), 1);
+}
+
 TEST_CASE("scalar-quantities")
 {
     gal::pga::plane<> p{1, 2, 3, 4};
@@ -0,0 +1,235 @@
+#include "test_util.hpp"
+
+#include <doctest/doctest.h>
+#include <gal/ik.hpp>
+#include <gal/thread_pool.hpp>
+
+#include <cmath>
+#include <vector>
+
+using namespace gal;
+using namespace gal::pga;
+
+TEST_SUITE_BEGIN("ik-solver");
+
+namespace
+{
+using pnt = gal::vga::point<float>;
+
+// Translation by (x, y, z)
+motor<> translation(float x, float y, float z)
+{
+    return {1, -0.5f * x, -0.5f * y, 0, -0.5f * z, 0, 0, 0};
+}
+
+// Three joints spaced one unit apart along x, the effector one unit past the last joint
+struct arm
+{
+    constexpr static size_t joints = 3;
+
+    std::vector<motor<>> offsets;
+    std::vector<motor<>> rotations;
+    std::vector<pnt> effectors;
+
+    explicit arm(size_t rigs)
+    {
+        for (size_t r = 0; r != rigs; ++r)
+        {
+            offsets.push_back(translation(0, 0.1f * r, 0));
+            offsets.push_back(translation(1, 0, 0));
+            offsets.push_back(translation(1, 0, 0));
+            for (size_t j = 0; j != joints; ++j)
+            {
+                rotations.push_back(motor<>{1, 0, 0, 0, 0, 0, 0, 0});
+            }
+            effectors.emplace_back(1.0f, 0.0f, 0.0f);
+        }
+    }
+
+    // Forward kinematics of the effector of a rig, composing one joint at a time
+    pnt effector(size_t rig) const
+    {
+        motor<> m = offsets[rig * joints];
+        for (size_t j = 0; j != joints; ++j)
+        {
+            if (j != 0)
+            {
+                m = gal::pga::compute(
+                    [](auto m, auto o) { return m * o; }, m, offsets[rig * joints + j]);
+            }
+            m = gal::pga::compute(
+                [](auto m, auto r) { return m * r; }, m, rotations[rig * joints + j]);
+        }
+        return gal::pga::compute([](auto m, auto p) { return m * p * ~m; }, m, effectors[rig]);
+    }
+};
+
+float distance(pnt const& a, pnt const& b)
+{
+    return std::sqrt((a.x - b.x) * (a.x - b.x) + (a.y - b.y) * (a.y - b.y)
+                     + (a.z - b.z) * (a.z - b.z));
+}
+} // namespace
+
+TEST_CASE("ccd")
+{
+    std::vector<float> unlimited(arm::joints, 4.0f);
+    ik_settings<> settings;
+    settings.max_iterations = 64;
+
+    SUBCASE("reach")
+    {
+        arm a{1};
+        std::vector<pnt> targets{pnt{1.5f, 1.2f, 0.5f}};
+        std::vector<float> errors(1);
+        ik_result result = solve_ik(arm::joints,
+                                    span{a.rotations},
+                                    span{a.offsets},
+                                    span{unlimited},
+                                    span{a.effectors},
+                                    span{targets},
+                                    settings,
+                                    span{errors});
+        CHECK(result.valid);
+        CHECK_EQ(result.converged, 1);
+        CHECK_LT(errors[0], settings.tolerance);
+        CHECK_LT(distance(a.effector(0), targets[0]), settings.tolerance);
+
+        // Joints remain pure rotations
+        for (motor<> const& r : a.rotations)
+        {
+            CHECK_EQ(r[1], 0.0f);
+            CHECK_EQ(r[2], 0.0f);
+            CHECK_EQ(r[4], 0.0f);
+            CHECK_EQ(r[7], 0.0f);
+            CHECK_EQ(r[0] * r[0] + r[3] * r[3] + r[5] * r[5] + r[6] * r[6],
+                     doctest::Approx(1.0f));
+        }
+    }
+
+    SUBCASE("batched")
+    {
+        // 21 rigs exercise both full blocks and the remainder. Every third target is out of reach.
+        size_t const rigs = 21;
+        arm batched{rigs};
+        std::vector<pnt> targets;
+        for (size_t r = 0; r != rigs; ++r)
+        {
+            float scale = r % 3 == 0 ? 4.0f : 1.0f;
+            targets.emplace_back(scale * std::cos(0.3f * r), scale * std::sin(0.3f * r), 0.5f);
+        }
+        std::vector<float> errors(rigs);
+        ik_result result = solve_ik(arm::joints,
+                                    span{batched.rotations},
+                                    span{batched.offsets},
+                                    span{unlimited},
+                                    span{batched.effectors},
+                                    span{targets},
+                                    settings,
+                                    span{errors});
+        CHECK_EQ(result.converged, rigs - 7);
+        CHECK_EQ(result.iterations, settings.max_iterations);
+
+        for (size_t r = 0; r != rigs; ++r)
+        {
+            // Rigs are independent of the others in their block
+            arm single{r + 1};
+            std::vector<float> error(1);
+            solve_ik(arm::joints,
+                     span{single.rotations}.subspan(r * arm::joints, arm::joints),
+                     span{single.offsets}.subspan(r * arm::joints, arm::joints),
+                     span{unlimited},
+                     span{single.effectors}.subspan(r, 1),
+                     span{targets}.subspan(r, 1),
+                     settings,
+                     span{error});
+            CHECK_EQ(errors[r], doctest::Approx(error[0]).epsilon(1e-4));
+            CHECK_EQ(distance(batched.effector(r), targets[r]), doctest::Approx(errors[r]));
+            if (r % 3 == 0)
+            {
+                // Unreachable targets leave the arm stretched towards them (its reach is 3)
+                float const root = distance(pnt{0.0f, 0.1f * r, 0.0f}, targets[r]);
+                CHECK_EQ(errors[r], doctest::Approx(root - 3.0f).epsilon(1e-3));
+            }
+            else
+            {
+                CHECK_LT(errors[r], settings.tolerance);
+            }
+        }
+    }
+
+    SUBCASE("joint-limits")
+    {
+        arm a{1};
+        std::vector<float> limits(arm::joints, 0.3f);
+        std::vector<pnt> targets{pnt{0.0f, 2.0f, 0.0f}};
+        ik_result result = solve_ik(arm::joints,
+                                    span{a.rotations},
+                                    span{a.offsets},
+                                    span{limits},
+                                    span{a.effectors},
+                                    span{targets},
+                                    settings);
+        CHECK_EQ(result.converged, 0);
+        for (motor<> const& r : a.rotations)
+        {
+            CHECK_LE(2.0f * std::acos(std::min(r[0], 1.0f)), 0.3f + 1e-4f);
+        }
+
+        // Every joint is pushed to its limit, bending the arm towards the target
+        CHECK_GT(a.effector(0).y, 1.0f);
+    }
+
+    SUBCASE("parallel")
+    {
+        size_t const rigs = 100;
+        arm serial{rigs};
+        arm parallel{rigs};
+        std::vector<pnt> targets;
+        for (size_t r = 0; r != rigs; ++r)
+        {
+            targets.emplace_back(std::cos(0.1f * r), 1.5f, std::sin(0.1f * r));
+        }
+
+        ik_result expected = solve_ik(arm::joints,
+                                      span{serial.rotations},
+                                      span{serial.offsets},
+                                      span{unlimited},
+                                      span{serial.effectors},
+                                      span{targets},
+                                      settings);
+        thread_pool pool{3};
+        ik_result result = parallel_solve_ik(pool,
+                                             arm::joints,
+                                             span{parallel.rotations},
+                                             span{parallel.offsets},
+                                             span{unlimited},
+                                             span{parallel.effectors},
+                                             span{targets},
+                                             settings);
+        CHECK_EQ(result.converged, expected.converged);
+        CHECK_EQ(result.iterations, expected.iterations);
+        for (size_t i = 0; i != serial.rotations.size(); ++i)
+        {
+            for (size_t j = 0; j != 8; ++j)
+            {
+                CHECK_EQ(parallel.rotations[i][j], serial.rotations[i][j]);
+            }
+        }
+    }
+
+    SUBCASE("invalid")
+    {
+        arm a{1};
+        std::vector<pnt> targets{pnt{1.0f, 1.0f, 0.0f}};
+        ik_result result = solve_ik(GAL_IK_CHAIN_CAPACITY + 1,
+                                    span{a.rotations},
+                                    span{a.offsets},
+                                    span{unlimited},
+                                    span{a.effectors},
+                                    span{targets});
+        CHECK_FALSE(result.valid);
+    }
+}
+
+TEST_SUITE_END();
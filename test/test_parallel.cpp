@@ -0,0 +1,91 @@
+#include "test_util.hpp"
+
+#include <doctest/doctest.h>
+#include <gal/pga.hpp>
+#include <gal/thread_pool.hpp>
+
+#include <atomic>
+#include <vector>
+
+using namespace gal;
+using namespace gal::pga;
+
+TEST_SUITE_BEGIN("parallel");
+
+TEST_CASE("thread-pool")
+{
+    thread_pool pool{3};
+    CHECK_EQ(pool.concurrency(), 4);
+
+    // Every task runs exactly once, across repeated dispatches
+    std::vector<std::atomic<int>> counts(1000);
+    for (int round = 0; round != 3; ++round)
+    {
+        pool.parallel_for(counts.size(), [&](size_t i) { ++counts[i]; });
+    }
+    for (auto& count : counts)
+    {
+        CHECK_EQ(count.load(), 3);
+    }
+
+    // Fewer tasks than threads
+    std::atomic<int> total{0};
+    pool.parallel_for(2, [&](size_t i) { total += static_cast<int>(i) + 1; });
+    CHECK_EQ(total.load(), 3);
+}
+
+TEST_CASE("parallel-compute")
+{
+    using pnt     = gal::pga::point<float>;
+    auto sandwich = [](auto p, auto m) { return m * p * ~m; };
+
+    // Enough elements for several chunks per thread, with a partial final chunk
+    constexpr size_t count = 1000;
+    std::vector<pnt> points;
+    std::vector<motor<>> motors;
+    for (size_t i = 0; i != count; ++i)
+    {
+        points.push_back(pnt{0.01f * i, 2.0f - 0.1f * i, 0.5f, 1.0f});
+        motors.push_back(motor<>{1.0f, 0.001f * i, -0.3f, 0.4f, 0.1f, 0.6f, -0.7f, 0.8f});
+    }
+
+    thread_pool pool{3};
+
+    SUBCASE("span")
+    {
+        std::vector<pnt> out(count);
+        gal::pga::parallel_compute(pool, sandwich, span{out}, span{points}, span{motors});
+        for (size_t i = 0; i != count; ++i)
+        {
+            pnt expected = gal::pga::compute(sandwich, points[i], motors[i]);
+            for (size_t c = 0; c != pnt::size(); ++c)
+            {
+                CHECK_EQ(out[i][c], doctest::Approx(expected[c]));
+            }
+        }
+    }
+
+    SUBCASE("aosoa")
+    {
+        std::vector<aosoa_block<pnt, 8>> blocks(aosoa_span<pnt, 8>::block_count(count));
+        std::vector<aosoa_block<pnt, 8>> out_blocks(blocks.size());
+        aosoa_span<pnt, 8> in{blocks.data(), count};
+        aosoa_span<pnt, 8> out{out_blocks.data(), count};
+        for (size_t i = 0; i != count; ++i)
+        {
+            in[i] = points[i];
+        }
+
+        gal::pga::parallel_compute(pool, sandwich, out, in, motors[7]);
+        for (size_t i = 0; i != count; ++i)
+        {
+            pnt expected = gal::pga::compute(sandwich, points[i], motors[7]);
+            for (size_t c = 0; c != pnt::size(); ++c)
+            {
+                CHECK_EQ(out[i][c], doctest::Approx(expected[c]));
+            }
+        }
+    }
+}
+
+TEST_SUITE_END();
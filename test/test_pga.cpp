@@ -4,6 +4,7 @@
 #include <gal/vga.hpp>
 
 #include <iostream>
+#include <vector>
 
 using namespace gal;
 using namespace gal::pga;
@@ -262,6 +263,21 @@ TEST_CASE("bivector-norm")
     CHECK_EQ(l2.size.term, 2);
 }
 
+TEST_CASE("vector-round-trip")
+{
+    gal::pga::vector<float> v{1.0f, -2.0f, 3.0f};
+
+    gal::pga::vector<float> same = compute([](auto v) { return v; }, v);
+    CHECK_EQ(same.x, doctest::Approx(1.0f));
+    CHECK_EQ(same.y, doctest::Approx(-2.0f));
+    CHECK_EQ(same.z, doctest::Approx(3.0f));
+
+    gal::pga::vector<float> scaled = compute([](auto v) { return 2 * v; }, v);
+    CHECK_EQ(scaled.x, doctest::Approx(2.0f));
+    CHECK_EQ(scaled.y, doctest::Approx(-4.0f));
+    CHECK_EQ(scaled.z, doctest::Approx(6.0f));
+}
+
 TEST_CASE("motors")
 {
     SUBCASE("simple-motor")
@@ -286,55 +302,48 @@ TEST_CASE("motors")
         CHECK_EQ(p3_motor.y, doctest::Approx(1.0));
         CHECK_EQ(p3_motor.z, doctest::Approx(0.0));
 
-        // line<> l2 = compute([](auto m) { return log(m); }, m);
-        // CHECK_EQ(l2.dz, doctest::Approx(M_PI / 4));
+        line<> l  = gal::pga::compute([](auto p1, auto p2) { return p2 & p1; }, p1, p2);
+        line<> l2 = motor<>{m}.log();
+        for (size_t i = 0; i != 6; ++i)
+        {
+            CHECK_EQ(l2[i], doctest::Approx(l[i]));
+        }
     }
 
     SUBCASE("line-exp")
     {
-        // Random line :)
-        // line<> l{3.234, -12.3, 4.2, 1.293, -3.58, -1.1};
-
-        // auto rpn = evaluate<line<>>::rpnf([](auto l) {
-        //     auto m  = exp(l);
-        //     auto l2 = log(m);
-        //     auto m2 = exp(l2);
-        //     // auto l3 = log(m2);
-        //     // return gal::make_tuple(m, l2, m2);
-        //     // return gal::make_tuple(m, l2);
-        //     return gal::make_tuple(l2);
-        // });
-        // printf("line-exp: %s\n", gal::to_string(rpn).c_str());
-        // TODO: the test below works on clang but not gcc
-        // auto result = compute(
-        //     [](auto l) {
-        //         auto m  = exp(l);
-        //         auto l2 = log(m);
-        //         auto m2 = exp(l2);
-        //         auto l3 = log(m2);
-        //         // return gal::make_tuple(m, l2, m2);
-        //         return m;
-        //     },
-        //     l);
-        // motor<> m  = std::get<0>(result);
-        // line<> l2  = std::get<1>(result);
-        // motor<> m2 = std::get<2>(result);
-        // // line<> l3  = std::get<3>(result);
-        // line<> l3 = l2;
-
-        // for (size_t i = 0; i != 6; ++i)
-        // {
-        //     CHECK_EQ(l2[i], doctest::Approx(l3[i]));
-        // }
-        // for (size_t i = 0; i != 8; ++i)
-        // {
-        //     CHECK_EQ(m[i], doctest::Approx(m2[i]));
-        // }
-
-        // auto m_norm = compute([](auto m) { return m * ~m; }, m2);
-        // printf("m_norm: %f, %f\n", m_norm[0], m_norm[1]);
-        // CHECK_EQ(m_norm[0], doctest::Approx(1));
-        // CHECK_EQ(m_norm[1], doctest::Approx(0));
+        // Random line :) (with a rotation angle below pi so that log recovers it)
+        line<> l{0.3234, -1.23, 0.42, 1.293, -3.58, -1.1};
+
+        motor<> m  = gal::pga::compute([](auto l) { return exp(l); }, l);
+        line<> l2  = m.log();
+        motor<> m2 = gal::pga::compute([](auto l) { return exp(l); }, l2);
+        for (size_t i = 0; i != 6; ++i)
+        {
+            CHECK_EQ(l2[i], doctest::Approx(l[i]));
+        }
+        for (size_t i = 0; i != 8; ++i)
+        {
+            CHECK_EQ(m2[i], doctest::Approx(m[i]));
+        }
+    }
+
+    SUBCASE("translation-exp")
+    {
+        // Ideal lines exponentiate to translators without dividing by the vanishing angle
+        line<> l{0, 0, 0, 1, 2, 3};
+        auto const m = gal::pga::compute([](auto l) { return exp(l); }, l);
+        auto const t = gal::pga::compute([](auto l) { return 1 + l; }, l);
+        for (elem_t e : {0b0, 0b11, 0b101, 0b1001, 0b110, 0b1010, 0b1100, 0b1111})
+        {
+            CHECK_EQ(m.select(e), doctest::Approx(t.select(e)));
+        }
+
+        line<> l2 = motor<>{m}.log();
+        for (size_t i = 0; i != 6; ++i)
+        {
+            CHECK_EQ(l2[i], doctest::Approx(l[i]));
+        }
     }
 
     SUBCASE("normalize-motor")
@@ -348,4 +357,322 @@ TEST_CASE("motors")
     }
 }
 
+TEST_CASE("batched-compute")
+{
+    auto sandwich = [](auto p, auto m) { return m * p * ~m; };
+
+    // 37 elements exercises both full blocks and the remainder
+    std::vector<pt> points;
+    std::vector<motor<>> motors;
+    for (size_t i = 0; i != 37; ++i)
+    {
+        points.push_back(pt{static_cast<float>(i), 2.0f - i, 0.5f * i});
+        motors.push_back(motor<>{1.0f + 0.1f * i, 0.2f, -0.3f, 0.4f, 0.1f * i, 0.6f, -0.7f, 0.8f});
+    }
+
+    SUBCASE("span-inputs")
+    {
+        std::vector<pt> out(points.size(), pt{0, 0, 0});
+        gal::pga::compute_batch(sandwich, span{out}, span{points}, span{motors});
+        for (size_t i = 0; i != out.size(); ++i)
+        {
+            pt expected = gal::pga::compute(sandwich, points[i], motors[i]);
+            CHECK_EQ(out[i].x, doctest::Approx(expected.x));
+            CHECK_EQ(out[i].y, doctest::Approx(expected.y));
+            CHECK_EQ(out[i].z, doctest::Approx(expected.z));
+        }
+    }
+
+    SUBCASE("broadcast-input")
+    {
+        std::vector<pt> out(points.size(), pt{0, 0, 0});
+        gal::pga::compute_batch(sandwich, span{out}, span{points}, motors[3]);
+        for (size_t i = 0; i != out.size(); ++i)
+        {
+            pt expected = gal::pga::compute(sandwich, points[i], motors[3]);
+            CHECK_EQ(out[i].x, doctest::Approx(expected.x));
+            CHECK_EQ(out[i].y, doctest::Approx(expected.y));
+            CHECK_EQ(out[i].z, doctest::Approx(expected.z));
+        }
+    }
+}
+
+TEST_CASE("bound-kernel")
+{
+    motor<> m{1.0f, 0.2f, -0.3f, 0.4f, 0.1f, 0.6f, -0.7f, 0.8f};
+
+    SUBCASE("sandwich")
+    {
+        auto sandwich = [](auto m, auto p) { return m * p * ~m; };
+        auto kernel   = gal::pga::bind<pt>(sandwich, m);
+        for (size_t i = 0; i != 8; ++i)
+        {
+            pt p{static_cast<float>(i), 2.0f - i, 0.5f * i};
+            pt expected = gal::pga::compute(sandwich, m, p);
+            pt actual   = kernel(p);
+            CHECK_EQ(actual.x, doctest::Approx(expected.x));
+            CHECK_EQ(actual.y, doctest::Approx(expected.y));
+            CHECK_EQ(actual.z, doctest::Approx(expected.z));
+        }
+    }
+
+    SUBCASE("bound-temporaries")
+    {
+        // The normalization of the line only depends on the bound line while the trigonometric
+        // functions of the angle remain part of the kernel
+        line<float> l{0.3f, -0.5f, 0.8f, 0.1f, 0.2f, -0.4f};
+        auto f = [](auto l, auto a, auto p) {
+            auto r = ::rotor(a, l);
+            return r * p * ~r;
+        };
+        auto kernel = gal::pga::bind<sc, pt>(f, l);
+        sc a{0.7f};
+        pt p{1.5f, 2.0f, 3.0f};
+        auto expected = gal::pga::compute(f, l, a, p);
+        auto actual   = kernel(a, p);
+        for (size_t i = 0; i != expected.size(); ++i)
+        {
+            CHECK_EQ(actual[i], doctest::Approx(expected[i]));
+        }
+    }
+
+    SUBCASE("multiple-results")
+    {
+        auto f      = [](auto m, auto p) { return gal::tuple{m * p * ~m, p + m}; };
+        auto kernel = gal::pga::bind<pt>(f, m);
+        pt p{-1.0f, 0.5f, 2.0f};
+        auto expected = gal::pga::compute(f, m, p);
+        auto actual   = kernel(p);
+        for (size_t i = 0; i != std::get<0>(expected).size(); ++i)
+        {
+            CHECK_EQ(std::get<0>(actual)[i], doctest::Approx(std::get<0>(expected)[i]));
+        }
+        for (size_t i = 0; i != std::get<1>(expected).size(); ++i)
+        {
+            CHECK_EQ(std::get<1>(actual)[i], doctest::Approx(std::get<1>(expected)[i]));
+        }
+    }
+}
+
+TEST_CASE("matrix-conversion")
+{
+    // A normalized motor rotating about an axis through (1, -1, 0) followed by a translation
+    float c = std::cos(0.6f);
+    float s = std::sin(0.6f);
+    motor<> r{c, 0.0f, 0.0f, s * 0.6f, 0.0f, -s * 0.8f, 0.0f, 0.0f};
+    motor<> t{1.0f, -0.5f, 0.25f, 0.0f, -1.0f, 0.0f, 0.0f, 0.0f};
+    motor<> m = gal::pga::compute([](auto t, auto r) { return t * r; }, t, r);
+
+    SUBCASE("to-matrix")
+    {
+        auto mat = to_matrix<4>(m);
+        pt p{1.5f, -2.0f, 0.5f};
+        pt expected = gal::pga::compute([](auto m, auto p) { return m * p * ~m; }, m, p);
+        CHECK_EQ(mat(0, 0) * p.x + mat(0, 1) * p.y + mat(0, 2) * p.z + mat(0, 3),
+                 doctest::Approx(expected.x));
+        CHECK_EQ(mat(1, 0) * p.x + mat(1, 1) * p.y + mat(1, 2) * p.z + mat(1, 3),
+                 doctest::Approx(expected.y));
+        CHECK_EQ(mat(2, 0) * p.x + mat(2, 1) * p.y + mat(2, 2) * p.z + mat(2, 3),
+                 doctest::Approx(expected.z));
+        CHECK_EQ(mat(3, 0), 0);
+        CHECK_EQ(mat(3, 3), 1);
+    }
+
+    SUBCASE("from-matrix")
+    {
+        // The rotation by 0.6 rad has a positive trace. Rotations by 3 rad have a negative trace,
+        // so rotation_quaternion extracts the quaternion from the largest diagonal entry, which
+        // is that of the x, y or z axis of rotation (or the z entry for the arbitrary axis).
+        struct
+        {
+            float angle;
+            float x;
+            float y;
+            float z;
+        } const rotations[] = {{0.6f, 0.0f, 0.0f, 1.0f},
+                               {3.0f, 1.0f, 0.0f, 0.0f},
+                               {3.0f, 0.0f, 1.0f, 0.0f},
+                               {3.0f, 0.0f, 0.0f, 1.0f},
+                               {3.0f, 2.0f / 7.0f, -3.0f / 7.0f, 6.0f / 7.0f}};
+        for (auto const& rotation : rotations)
+        {
+            float c = std::cos(rotation.angle / 2);
+            float s = std::sin(rotation.angle / 2);
+            // The rotation bivectors are e12, e13 and e23 (see from_matrix)
+            motor<> ra{
+                c, 0.0f, 0.0f, -s * rotation.z, 0.0f, s * rotation.y, -s * rotation.x, 0.0f};
+            motor<> ma = gal::pga::compute([](auto t, auto r) { return t * r; }, t, ra);
+
+            auto mat = to_matrix(ma);
+            if (rotation.angle > 1.6f)
+            {
+                CHECK_LT(mat(0, 0) + mat(1, 1) + mat(2, 2), 0.0f);
+            }
+
+            motor<> out = from_matrix(mat);
+            // m and -m encode the same transform
+            float dot = 0.0f;
+            for (size_t i = 0; i != 8; ++i)
+            {
+                dot += out[i] * ma[i];
+            }
+            float sign = dot < 0 ? -1.0f : 1.0f;
+            for (size_t i = 0; i != 8; ++i)
+            {
+                CHECK_EQ(sign * out[i], doctest::Approx(ma[i]));
+            }
+        }
+    }
+
+    SUBCASE("batched")
+    {
+        // 11 motors cover a full block of lanes and a partial one
+        std::vector<motor<>> motors;
+        for (size_t i = 0; i != 11; ++i)
+        {
+            float a = 0.2f * i;
+            motors.push_back(
+                motor<>{std::cos(a), 0.1f * i, 0.0f, std::sin(a), -0.2f, 0.0f, 0.0f, 0.0f});
+        }
+        std::vector<gal::matrix<float, 3, 4>> out(motors.size());
+        to_matrix(span{out}, span{motors});
+        for (size_t i = 0; i != motors.size(); ++i)
+        {
+            auto expected = to_matrix(motors[i]);
+            for (size_t j = 0; j != expected.size(); ++j)
+            {
+                CHECK_EQ(out[i][j], doctest::Approx(expected[j]));
+            }
+        }
+    }
+}
+
+TEST_CASE("normalized-motor")
+{
+    float c = std::cos(0.6f);
+    float s = std::sin(0.6f);
+    motor<> r{c, 0.0f, 0.0f, s * 0.6f, 0.0f, -s * 0.8f, 0.0f, 0.0f};
+    motor<> t{1.0f, -0.5f, 0.25f, 0.0f, -1.0f, 0.0f, 0.0f, 0.0f};
+    motor<> m = gal::pga::compute([](auto t, auto r) { return t * r; }, t, r);
+    normalized<motor<>> nm{m};
+    auto sandwich = [](auto m, auto p) { return m * p * ~m; };
+
+    SUBCASE("sandwich")
+    {
+        pt p{1.5f, -2.0f, 0.5f};
+        pt expected = gal::pga::compute(sandwich, m, p);
+        pt actual   = gal::pga::compute(sandwich, nm, p);
+        CHECK_EQ(actual.x, doctest::Approx(expected.x));
+        CHECK_EQ(actual.y, doctest::Approx(expected.y));
+        CHECK_EQ(actual.z, doctest::Approx(expected.z));
+
+        // The weight of the transformed point no longer depends on the motor
+        op_count general    = evaluate<motor<>, pt>::cost(sandwich);
+        op_count unit_motor = evaluate<normalized<motor<>>, pt>::cost(sandwich);
+        CHECK_LT(unit_motor.mul, general.mul);
+        CHECK_LT(unit_motor.add, general.add);
+    }
+
+    SUBCASE("matrix")
+    {
+        auto expected = to_matrix(m);
+        auto actual   = to_matrix(nm);
+        for (size_t i = 0; i != expected.size(); ++i)
+        {
+            CHECK_EQ(actual[i], doctest::Approx(expected[i]));
+        }
+    }
+}
+
+TEST_CASE("motor-interpolation")
+{
+    motor<> m0 = gal::pga::compute([](auto l) { return exp(l); }, line<>{0.1f, 0.2f, 0.3f, 1, 2, 3});
+    motor<> m1
+        = gal::pga::compute([](auto l) { return exp(l); }, line<>{-0.3f, 0.5f, 0.1f, -1, 0, 2});
+
+    SUBCASE("endpoints")
+    {
+        motor<> start = interpolate(m0, m1, 0.0f);
+        motor<> end   = interpolate(m0, m1, 1.0f);
+        for (size_t i = 0; i != 8; ++i)
+        {
+            CHECK_EQ(start[i], doctest::Approx(m0[i]));
+            CHECK_EQ(end[i], doctest::Approx(m1[i]).epsilon(1e-4));
+        }
+    }
+
+    SUBCASE("constant-speed")
+    {
+        // Two half steps compose to the full motion
+        motor<> half = interpolate(m0, m1, 0.5f);
+        motor<> full = gal::pga::compute(
+            [](auto m0, auto half) { return half * ~m0 * half; }, m0, half);
+        for (size_t i = 0; i != 8; ++i)
+        {
+            CHECK_EQ(full[i], doctest::Approx(m1[i]).epsilon(1e-4));
+        }
+    }
+
+    SUBCASE("flipped-signs")
+    {
+        // m and -m are the same pose, so the interpolation between them stays at m
+        motor<> flipped  = gal::pga::compute([](auto m) { return -m; }, m0);
+        motor<> constant = interpolate(m0, flipped, 0.5f);
+        for (size_t i = 0; i != 8; ++i)
+        {
+            CHECK_EQ(constant[i], doctest::Approx(m0[i]));
+        }
+
+        // Flipping either keyframe leaves the path unchanged up to the sign of the result
+        motor<> expected = interpolate(m0, m1, 0.3f);
+        motor<> negated  = gal::pga::compute([](auto m) { return -m; }, m1);
+        motor<> path     = interpolate(m0, negated, 0.3f);
+        float s          = path[0] * expected[0] < 0 ? -1.0f : 1.0f;
+        for (size_t i = 0; i != 8; ++i)
+        {
+            CHECK_EQ(s * path[i], doctest::Approx(expected[i]).epsilon(1e-4));
+        }
+
+        // Lanes of a batch holding keyframes of either sign
+        std::vector<motor<>> ends;
+        for (size_t i = 0; i != 11; ++i)
+        {
+            ends.push_back(i % 2 == 0 ? m1 : negated);
+        }
+        std::vector<motor<>> out(ends.size(), m0);
+        interpolate(span{out}, m0, span{ends}, 0.3f);
+        for (size_t i = 0; i != out.size(); ++i)
+        {
+            for (size_t j = 0; j != 8; ++j)
+            {
+                CHECK_EQ(out[i][j], doctest::Approx(path[j]).epsilon(1e-4));
+            }
+        }
+    }
+
+    SUBCASE("batched")
+    {
+        // 37 channels exercise both full blocks and the remainder
+        std::vector<motor<>> starts;
+        std::vector<float> ts;
+        for (size_t i = 0; i != 37; ++i)
+        {
+            line<> l{0.1f, -0.02f * i, 0.3f, 1, 0.1f * i, 3};
+            starts.push_back(gal::pga::compute([](auto l) { return exp(l); }, l));
+            ts.push_back(i / 36.0f);
+        }
+
+        std::vector<motor<>> out(starts.size(), m0);
+        interpolate(span{out}, span{starts}, m1, span{ts});
+        for (size_t i = 0; i != out.size(); ++i)
+        {
+            motor<> expected = interpolate(starts[i], m1, ts[i]);
+            for (size_t j = 0; j != 8; ++j)
+            {
+                CHECK_EQ(out[i][j], doctest::Approx(expected[j]));
+            }
+        }
+    }
+}
+
 TEST_SUITE_END();
@@ -0,0 +1,292 @@
+#include "test_util.hpp"
+
+#include <doctest/doctest.h>
+#include <gal/pga.hpp>
+#include <gal/runtime.hpp>
+
+#include <memory>
+#include <vector>
+
+using namespace gal;
+using namespace gal::pga;
+
+TEST_SUITE_BEGIN("runtime");
+
+TEST_CASE("runtime-sandwich")
+{
+    using pnt     = gal::pga::point<float>;
+    auto sandwich = [](auto p, auto m) { return m * p * ~m; };
+
+    runtime::context<pga_algebra> ctx;
+    auto p = ctx.input<pnt>();
+    auto m = ctx.input<motor<>>();
+    runtime::program<pga_algebra> program{ctx, sandwich(p, m)};
+    REQUIRE(program.valid());
+    CHECK_EQ(program.input_size(), pnt::size() + motor<>::size());
+
+    pnt p1{1.0f, -2.0f, 3.0f, 1.0f};
+    motor<> m1{1.0f, 0.2f, -0.3f, 0.4f, 0.5f, 0.6f, -0.7f, 0.8f};
+    pnt expected = gal::pga::compute(sandwich, p1, m1);
+    REQUIRE_EQ(program.output_size(), pnt::size());
+
+    float out[pnt::size()];
+    program(out, p1, m1);
+    for (size_t i = 0; i != pnt::size(); ++i)
+    {
+        CHECK_EQ(program.element(i), pnt::ie(0).terms[i].element);
+        CHECK_EQ(out[i], doctest::Approx(expected[i]));
+    }
+
+    SUBCASE("batched")
+    {
+        // 37 elements leaves the final group of lanes partially occupied
+        constexpr size_t count = 37;
+        std::vector<float> in(count * program.input_size());
+        std::vector<float> results(count * program.output_size());
+        for (size_t i = 0; i != count; ++i)
+        {
+            pnt pi{static_cast<float>(i), 2.0f - i, 0.5f * i, 1.0f};
+            motor<> mi{1.0f + 0.1f * i, 0.2f, -0.3f, 0.4f, 0.1f * i, 0.6f, -0.7f, 0.8f};
+            float* row = in.data() + i * program.input_size();
+            for (size_t c = 0; c != pnt::size(); ++c)
+            {
+                row[c] = pi[c];
+            }
+            for (size_t c = 0; c != motor<>::size(); ++c)
+            {
+                row[pnt::size() + c] = mi[c];
+            }
+        }
+
+        program.evaluate(span<float const>{in}, span<float>{results});
+        for (size_t i = 0; i != count; ++i)
+        {
+            float const* row = in.data() + i * program.input_size();
+            pnt pi{row[0], row[1], row[2], row[3]};
+            motor<> mi{row[4], row[5], row[6], row[7], row[8], row[9], row[10], row[11]};
+            pnt e = gal::pga::compute(sandwich, pi, mi);
+            for (size_t c = 0; c != pnt::size(); ++c)
+            {
+                CHECK_EQ(results[i * program.output_size() + c], doctest::Approx(e[c]));
+            }
+        }
+    }
+}
+
+TEST_CASE("runtime-composition")
+{
+    // Compose a chain of motors whose length is only known at runtime
+    runtime::context<pga_algebra> ctx;
+    runtime::expr<pga_algebra> chain = ctx.input<motor<>>();
+    size_t const length              = 3;
+    for (size_t i = 1; i != length; ++i)
+    {
+        chain = chain * ctx.input<motor<>>();
+    }
+    runtime::program<pga_algebra> program{ctx, chain};
+    REQUIRE(program.valid());
+
+    motor<> m1{1.0f, 0.2f, -0.3f, 0.4f, 0.5f, 0.6f, -0.7f, 0.8f};
+    motor<> m2{0.5f, -0.1f, 0.3f, 0.2f, -0.4f, 0.1f, 0.9f, -0.2f};
+    motor<> m3{0.9f, 0.4f, 0.1f, -0.6f, 0.3f, -0.5f, 0.2f, 0.7f};
+    auto const expected = gal::pga::compute(
+        [](auto m1, auto m2, auto m3) { return m1 * m2 * m3; }, m1, m2, m3);
+
+    std::vector<float> out(program.output_size());
+    program(out.data(), m1, m2, m3);
+    for (size_t i = 0; i != program.output_size(); ++i)
+    {
+        CHECK_EQ(out[i], doctest::Approx(expected.select(program.element(i))));
+    }
+}
+
+TEST_CASE("runtime-composed-sandwich")
+{
+    // The composed motor is both a common subexpression and large enough to be spilled
+    using pnt     = gal::pga::point<float>;
+    auto sandwich = [](auto p, auto m1, auto m2) { return (m1 * m2) * p * ~(m1 * m2); };
+
+    runtime::context<pga_algebra> ctx;
+    auto p  = ctx.input<pnt>();
+    auto m1 = ctx.input<motor<>>();
+    auto m2 = ctx.input<motor<>>();
+    runtime::program<pga_algebra> program{ctx, sandwich(p, m1, m2)};
+    REQUIRE(program.valid());
+
+    pnt p1{1.0f, -2.0f, 3.0f, 1.0f};
+    motor<> a{1.0f, 0.2f, -0.3f, 0.4f, 0.5f, 0.6f, -0.7f, 0.8f};
+    motor<> b{0.5f, -0.1f, 0.3f, 0.2f, -0.4f, 0.1f, 0.9f, -0.2f};
+    auto const expected = gal::pga::compute(sandwich, p1, a, b);
+
+    std::vector<float> out(program.output_size());
+    program(out.data(), p1, a, b);
+    for (size_t i = 0; i != program.output_size(); ++i)
+    {
+        CHECK_EQ(out[i], doctest::Approx(expected.select(program.element(i))).epsilon(1e-4));
+    }
+}
+
+TEST_CASE("runtime-transcendentals")
+{
+    using sc = scalar<pga_algebra, float>;
+    auto f   = [](auto s) { return sin(s * PI) + cos(s) * 1_e12 + sqrt(s) / (s * s); };
+
+    runtime::context<pga_algebra> ctx;
+    runtime::program<pga_algebra, double> program{ctx, f(ctx.input<sc>())};
+    REQUIRE(program.valid());
+
+    for (float s : {0.25f, 1.0f, 2.5f})
+    {
+        auto const expected = gal::pga::compute(f, sc{s});
+        std::vector<double> out(program.output_size());
+        double in = s;
+        program.evaluate(&in, out.data());
+        for (size_t i = 0; i != program.output_size(); ++i)
+        {
+            CHECK_EQ(out[i], doctest::Approx(expected.select(program.element(i))).epsilon(1e-5));
+        }
+    }
+}
+
+TEST_CASE("runtime-sign")
+{
+    using sc = scalar<pga_algebra, float>;
+    auto f   = [](auto s) { return sign(s - 1) * 1_e12 + s; };
+
+    runtime::context<pga_algebra> ctx;
+    runtime::program<pga_algebra, double> program{ctx, f(ctx.input<sc>())};
+    REQUIRE(program.valid());
+
+    for (float s : {0.25f, 1.0f, 2.5f})
+    {
+        auto const expected = gal::pga::compute(f, sc{s});
+        std::vector<double> out(program.output_size());
+        double in = s;
+        program.evaluate(&in, out.data());
+        for (size_t i = 0; i != program.output_size(); ++i)
+        {
+            CHECK_EQ(out[i], doctest::Approx(expected.select(program.element(i))));
+        }
+        CHECK_EQ(expected.select(0b110), s < 1.0f ? -1.0f : 1.0f);
+    }
+}
+
+TEST_CASE("runtime-exp-log")
+{
+    auto f = [](auto l, auto m) { return exp(l) + log(m); };
+
+    runtime::context<pga_algebra> ctx;
+    auto l = ctx.input<line<>>();
+    auto m = ctx.input<motor<>>();
+    runtime::program<pga_algebra> program{ctx, f(l, m)};
+    REQUIRE(program.valid());
+
+    line<> l1{0.1f, -0.4f, 0.3f, 1.0f, 2.0f, -0.5f};
+    line<> l2{0.3f, 0.2f, -0.1f, 0.5f, -1.0f, 0.4f};
+    motor<> m1          = gal::pga::compute([](auto l) { return exp(l); }, l2);
+    auto const expected = gal::pga::compute(f, l1, m1);
+
+    std::vector<float> out(program.output_size());
+    program(out.data(), l1, m1);
+    for (size_t i = 0; i != program.output_size(); ++i)
+    {
+        CHECK_EQ(out[i], doctest::Approx(expected.select(program.element(i))).epsilon(1e-4));
+    }
+
+    SUBCASE("pure-translation")
+    {
+        // The closed forms reach their limits without dividing by the vanishing rotation angle
+        line<> t{0.0f, 0.0f, 0.0f, 1.0f, 2.0f, 3.0f};
+        program(out.data(), t, gal::pga::compute([](auto l) { return exp(l); }, t));
+        auto const e = gal::pga::compute(f, t, gal::pga::compute([](auto l) { return exp(l); }, t));
+        for (size_t i = 0; i != program.output_size(); ++i)
+        {
+            CHECK_EQ(out[i], doctest::Approx(e.select(program.element(i))));
+        }
+    }
+}
+
+TEST_CASE("runtime-exact-coefficients")
+{
+    // A sandwich by a chain of blended motors, and the same chain with its weights scaled to
+    // integers. The two differ by a constant factor only, so reduced with exact coefficients they
+    // lower to the same code. With 32-bit rationals the coefficients of the fractional weights
+    // are nudged (see overflow_gate in numeric.hpp) and terms that should cancel survive.
+    runtime::context<pga_algebra> ctx;
+    auto p = ctx.input<point<>>();
+    auto a = ctx.input<motor<>>();
+    auto b = ctx.input<motor<>>();
+    auto c = ctx.input<motor<>>();
+    runtime::program<pga_algebra, double> blended{
+        ctx, (a + b / 97) * (b + c / 4099) * p * (~b + ~c / 4099) * (~a + ~b / 97)};
+    runtime::program<pga_algebra, double> scaled{
+        ctx, (97 * a + b) * (4099 * b + c) * p * (4099 * ~b + ~c) * (97 * ~a + ~b)};
+    REQUIRE(blended.valid());
+    REQUIRE(scaled.valid());
+
+#if GAL_RATIONAL_BITS == 64
+    CHECK_EQ(blended.instruction_count(), scaled.instruction_count());
+
+    point<double> p1{1.0, -2.0, 3.0, 1.0};
+    motor<double> m1{1.0, 0.2, -0.3, 0.4, 0.5, 0.6, -0.7, 0.8};
+    motor<double> m2{0.5, -0.1, 0.3, 0.2, -0.4, 0.1, 0.9, -0.2};
+    motor<double> m3{0.9, 0.4, 0.1, -0.6, 0.3, -0.5, 0.2, 0.7};
+    std::vector<double> lhs(blended.output_size());
+    std::vector<double> rhs(scaled.output_size());
+    blended(lhs.data(), p1, m1, m2, m3);
+    scaled(rhs.data(), p1, m1, m2, m3);
+    double const scale = 97.0 * 97.0 * 4099.0 * 4099.0;
+    for (size_t i = 0; i != blended.output_size(); ++i)
+    {
+        CHECK_EQ(lhs[i], doctest::Approx(scaled.select(rhs.data(), blended.element(i)) / scale));
+    }
+#else
+    CHECK_GT(blended.instruction_count(), scaled.instruction_count());
+#endif
+}
+
+TEST_CASE("runtime-workspace")
+{
+    // A caller-supplied workspace may be reused across programs without being cleared
+    using pnt = gal::pga::point<float>;
+    auto ws   = std::make_unique<runtime::workspace<pga_algebra>>();
+
+    runtime::context<pga_algebra> ctx;
+    auto p = ctx.input<pnt>();
+    auto m = ctx.input<motor<>>();
+    runtime::program<pga_algebra> product{ctx, m * m, *ws};
+    runtime::program<pga_algebra> sandwich{ctx, m * p * ~m, *ws};
+    REQUIRE(product.valid());
+    REQUIRE(sandwich.valid());
+
+    pnt p1{1.0f, -2.0f, 3.0f, 1.0f};
+    motor<> m1{1.0f, 0.2f, -0.3f, 0.4f, 0.5f, 0.6f, -0.7f, 0.8f};
+    auto const expected = gal::pga::compute([](auto p, auto m) { return m * p * ~m; }, p1, m1);
+
+    std::vector<float> out(sandwich.output_size());
+    sandwich(out.data(), p1, m1);
+    for (size_t i = 0; i != sandwich.output_size(); ++i)
+    {
+        CHECK_EQ(out[i], doctest::Approx(expected.select(sandwich.element(i))));
+    }
+}
+
+TEST_CASE("runtime-capacity")
+{
+    // Exceeding the expression capacity produces an invalid program rather than failing silently
+    runtime::context<pga_algebra> ctx;
+    runtime::expr<pga_algebra> sum = ctx.input<motor<>>();
+    runtime::expr<pga_algebra> m   = ctx.input<motor<>>();
+    for (size_t i = 0; i != GAL_RUNTIME_NODE_CAPACITY; ++i)
+    {
+        sum = sum * m;
+    }
+    CHECK(sum.overflow);
+
+    runtime::program<pga_algebra> program{ctx, sum};
+    CHECK_FALSE(program.valid());
+    CHECK_EQ(program.status(), runtime::status::expression_overflow);
+    CHECK_EQ(program.output_size(), 0);
+}
+
+TEST_SUITE_END();
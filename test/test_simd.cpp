@@ -0,0 +1,212 @@
+#include "test_util.hpp"
+
+#include <doctest/doctest.h>
+#include <gal/aosoa.hpp>
+#include <gal/pga.hpp>
+#include <gal/simd.hpp>
+#include <gal/vga.hpp>
+
+#include <vector>
+
+using namespace gal;
+using namespace gal::pga;
+
+TEST_SUITE_BEGIN("simd");
+
+TEST_CASE("simd-lanes")
+{
+    float8 a{2.0f};
+    float8 b = a * 3 + 1;
+    for (size_t i = 0; i != float8::size(); ++i)
+    {
+        CHECK_EQ(b[i], 7.0f);
+    }
+
+    b[3]     = 16.0f;
+    float8 c = sqrt(b);
+    CHECK_EQ(c[3], doctest::Approx(4.0f));
+    CHECK_EQ(c[0], doctest::Approx(std::sqrt(7.0f)));
+
+    // Widths that are not a power of two are aligned to the next one
+    static_assert(alignof(simd<float, 3>) == 16);
+    simd<float, 3> d = simd<float, 3>{1.0f} + 2;
+    CHECK_EQ(d[2], 3.0f);
+}
+
+TEST_CASE("simd-compute")
+{
+    // Evaluate eight distinct motors applied to eight distinct points in a single compute
+    vga::point<float8> p{0.0f, 0.0f, 0.0f};
+    motor<float8> m{1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f};
+    for (size_t i = 0; i != float8::size(); ++i)
+    {
+        p.x[i] = 1.0f + i;
+        p.y[i] = -0.5f * i;
+        p.z[i] = 0.25f;
+        m[0][i] = 1.0f + 0.1f * i;
+        m[1][i] = 0.2f * i;
+        m[2][i] = -0.3f;
+        m[3][i] = 0.4f;
+        m[4][i] = 0.5f;
+        m[5][i] = -0.1f * i;
+        m[6][i] = 0.7f;
+        m[7][i] = 0.05f * i;
+    }
+
+    auto sandwich        = [](auto p, auto m) { return m * p * ~m; };
+    vga::point<float8> r = gal::pga::compute(sandwich, p, m);
+
+    for (size_t i = 0; i != float8::size(); ++i)
+    {
+        vga::point<float> p1{p.x[i], p.y[i], p.z[i]};
+        motor<float> m1{m[0][i], m[1][i], m[2][i], m[3][i], m[4][i], m[5][i], m[6][i], m[7][i]};
+        vga::point<float> r1 = gal::pga::compute(sandwich, p1, m1);
+        CHECK_EQ(r.x[i], doctest::Approx(r1.x));
+        CHECK_EQ(r.y[i], doctest::Approx(r1.y));
+        CHECK_EQ(r.z[i], doctest::Approx(r1.z));
+    }
+
+    SUBCASE("transcendentals")
+    {
+        using sc = scalar<pga_algebra, float8>;
+        sc s{0.0f};
+        for (size_t i = 0; i != float8::size(); ++i)
+        {
+            s.value[i] = 0.25f * i;
+        }
+        auto r2 = gal::pga::compute([](auto s) { return sin(s * PI) + cos(s) * 1_e12; }, s);
+        for (size_t i = 0; i != float8::size(); ++i)
+        {
+            CHECK_EQ(r2[0][i], doctest::Approx(std::sin(0.25f * i * M_PI)));
+            CHECK_EQ(r2[1][i], doctest::Approx(std::cos(0.25f * i)));
+        }
+    }
+
+    SUBCASE("normalize")
+    {
+        m.normalize();
+        auto m_norm = gal::pga::compute([](auto m) { return m * ~m; }, m);
+        for (size_t i = 0; i != float8::size(); ++i)
+        {
+            CHECK_EQ(m_norm[0][i], doctest::Approx(1));
+            CHECK_EQ(m_norm[1][i], doctest::Approx(0));
+        }
+    }
+}
+
+TEST_CASE("aosoa-compute")
+{
+    using pnt     = gal::pga::point<float>;
+    auto sandwich = [](auto p, auto m) { return m * p * ~m; };
+
+    // 37 elements leaves the final block partially occupied
+    constexpr size_t count = 37;
+    std::vector<aosoa_block<pnt, 8>> point_blocks(aosoa_span<pnt, 8>::block_count(count));
+    std::vector<aosoa_block<motor<>, 8>> motor_blocks(point_blocks.size());
+    aosoa_span<pnt, 8> points{point_blocks.data(), count};
+    aosoa_span<motor<>, 8> motors{motor_blocks.data(), count};
+    for (size_t i = 0; i != count; ++i)
+    {
+        points[i] = pnt{static_cast<float>(i), 2.0f - i, 0.5f * i, 1.0f};
+        motors[i] = motor<>{1.0f + 0.1f * i, 0.2f, -0.3f, 0.4f, 0.1f * i, 0.6f, -0.7f, 0.8f};
+    }
+    CHECK_EQ(points[9][1], -7.0f);
+    CHECK_EQ(motor_blocks[1][4][1], doctest::Approx(0.9f));
+
+    SUBCASE("aosoa-layout")
+    {
+        std::vector<aosoa_block<pnt, 8>> out_blocks(point_blocks.size());
+        aosoa_span<pnt, 8> out{out_blocks.data(), count};
+        gal::pga::compute_batch(sandwich, out, points, motors);
+        for (size_t i = 0; i != count; ++i)
+        {
+            // Proxies are valid compute inputs
+            pnt expected = gal::pga::compute(sandwich, points[i], motors[i]);
+            for (size_t c = 0; c != pnt::size(); ++c)
+            {
+                CHECK_EQ(out[i][c], doctest::Approx(expected[c]));
+            }
+        }
+    }
+
+    SUBCASE("odd-width")
+    {
+        // Elements are reached through the rows of their block at widths of any size
+        std::vector<aosoa_block<pnt, 3>> in_blocks(aosoa_span<pnt, 3>::block_count(count));
+        std::vector<aosoa_block<pnt, 3>> out_blocks(in_blocks.size());
+        aosoa_span<pnt, 3> in{in_blocks.data(), count};
+        aosoa_span<pnt, 3> out{out_blocks.data(), count};
+        for (size_t i = 0; i != count; ++i)
+        {
+            in[i] = pnt{points[i][0], points[i][1], points[i][2], points[i][3]};
+        }
+        CHECK_EQ(in_blocks[3][1][0], -7.0f);
+
+        gal::pga::compute_batch(sandwich, out, in, motors[5]);
+        for (size_t i = 0; i != count; ++i)
+        {
+            pnt expected = gal::pga::compute(sandwich, in[i], motors[5]);
+            for (size_t c = 0; c != pnt::size(); ++c)
+            {
+                CHECK_EQ(out[i][c], doctest::Approx(expected[c]));
+            }
+        }
+    }
+
+    SUBCASE("soa-layout")
+    {
+        size_t stride = soa_span<pnt>::padded_stride(count, 8);
+        std::vector<float> in_storage(soa_span<pnt>::storage_size(count, 8));
+        std::vector<float> out_storage(in_storage.size());
+        soa_span<pnt> in{in_storage.data(), count, stride};
+        soa_span<pnt> out{out_storage.data(), count, stride};
+        for (size_t i = 0; i != count; ++i)
+        {
+            in[i] = pnt{points[i][0], points[i][1], points[i][2], points[i][3]};
+        }
+        CHECK_EQ(in.row(1)[9], -7.0f);
+
+        gal::pga::compute_batch(sandwich, out, in, motors[5]);
+        for (size_t i = 0; i != count; ++i)
+        {
+            pnt expected = gal::pga::compute(sandwich, in[i], motors[5]);
+            for (size_t c = 0; c != pnt::size(); ++c)
+            {
+                CHECK_EQ(out[i][c], doctest::Approx(expected[c]));
+            }
+        }
+    }
+
+    SUBCASE("converted-output")
+    {
+        // Composed motors are converted to the output entity over all lanes
+        std::vector<aosoa_block<motor<>, 8>> out_blocks(motor_blocks.size());
+        aosoa_span<motor<>, 8> out{out_blocks.data(), count};
+        auto compose = [](auto m1, auto m2) { return m1 * m2; };
+        gal::pga::compute_batch(compose, out, motors, motors[3]);
+        for (size_t i = 0; i != count; ++i)
+        {
+            motor<> expected = gal::pga::compute(compose, motors[i], motors[3]);
+            for (size_t c = 0; c != motor<>::size(); ++c)
+            {
+                CHECK_EQ(out[i][c], doctest::Approx(expected[c]));
+            }
+        }
+    }
+
+    SUBCASE("span-output")
+    {
+        std::vector<pnt> out(count);
+        gal::pga::compute_batch(sandwich, span{out}, points, motors);
+        for (size_t i = 0; i != count; ++i)
+        {
+            pnt expected = gal::pga::compute(sandwich, points[i], motors[i]);
+            for (size_t c = 0; c != pnt::size(); ++c)
+            {
+                CHECK_EQ(out[i][c], doctest::Approx(expected[c]));
+            }
+        }
+    }
+}
+
+TEST_SUITE_END();
@@ -0,0 +1,163 @@
+#include "test_util.hpp"
+
+#include <doctest/doctest.h>
+#include <gal/skeleton.hpp>
+#include <gal/thread_pool.hpp>
+
+#include <vector>
+
+using namespace gal;
+using namespace gal::pga;
+
+TEST_SUITE_BEGIN("skeleton");
+
+namespace
+{
+// Three small rigs with branching chains, concatenated as a single hierarchy
+std::vector<int32_t> crowd_parents()
+{
+    std::vector<int32_t> parents;
+    for (int32_t rig = 0; rig != 3; ++rig)
+    {
+        auto base = static_cast<int32_t>(parents.size());
+        parents.insert(parents.end(),
+                       {skeleton::root, base, base + 1, base + 2, base + 1, base + 4, base,
+                        base + 6, base + 7, base + 8, base + 9, base + 10});
+    }
+    return parents;
+}
+
+std::vector<motor<>> local_motors(size_t count)
+{
+    std::vector<motor<>> local;
+    for (size_t i = 0; i != count; ++i)
+    {
+        line<> l{0.05f * i, -0.1f, 0.2f, 0.5f, 0.1f * i, -0.3f};
+        local.push_back(gal::pga::compute([](auto l) { return exp(l); }, l));
+    }
+    return local;
+}
+
+// One compute per joint, in index order
+std::vector<motor<>> reference(std::vector<int32_t> const& parents,
+                               std::vector<motor<>> const& local,
+                               motor<> const& root_motor)
+{
+    std::vector<motor<>> world(local);
+    for (size_t i = 0; i != parents.size(); ++i)
+    {
+        motor<> const& parent = parents[i] == skeleton::root ? root_motor : world[parents[i]];
+        world[i] = gal::pga::compute([](auto p, auto l) { return p * l; }, parent, local[i]);
+    }
+    return world;
+}
+} // namespace
+
+TEST_CASE("skeleton-levels")
+{
+    std::vector<int32_t> parents = crowd_parents();
+    std::vector<uint32_t> order(parents.size());
+    skeleton s{parents, order};
+    CHECK(s.valid());
+    CHECK_EQ(s.size(), parents.size());
+    CHECK_EQ(s.depth(), 7);
+
+    // Every level holds joints of equal depth in ascending order across all rigs
+    CHECK_EQ(s.level(0).size(), 3);
+    CHECK_EQ(s.level(0)[1], 12);
+    CHECK_EQ(s.level(1).size(), 6);
+    CHECK_EQ(s.level(6).size(), 3);
+    CHECK_EQ(s.level(6)[2], 35);
+
+    SUBCASE("invalid")
+    {
+        std::vector<int32_t> cyclic{skeleton::root, 2, 0};
+        skeleton bad{cyclic, order};
+        CHECK_FALSE(bad.valid());
+        CHECK_EQ(bad.depth(), 0);
+
+        std::vector<uint32_t> small(2);
+        skeleton truncated{parents, small};
+        CHECK_FALSE(truncated.valid());
+    }
+}
+
+TEST_CASE("forward-kinematics")
+{
+    std::vector<int32_t> parents = crowd_parents();
+    std::vector<uint32_t> order(parents.size());
+    skeleton s{parents, order};
+
+    std::vector<motor<>> local = local_motors(parents.size());
+    motor<> root_motor
+        = gal::pga::compute([](auto l) { return exp(l); }, line<>{0.3f, 0.1f, 0.0f, 2, 0, 1});
+    motor<> identity{1, 0, 0, 0, 0, 0, 0, 0};
+
+    SUBCASE("world-motors")
+    {
+        std::vector<motor<>> world(parents.size(), identity);
+        s.forward_kinematics(span{world}, span{local});
+        std::vector<motor<>> expected = reference(parents, local, identity);
+        for (size_t i = 0; i != world.size(); ++i)
+        {
+            for (size_t j = 0; j != 8; ++j)
+            {
+                CHECK_EQ(world[i][j], doctest::Approx(expected[i][j]).epsilon(1e-4));
+            }
+        }
+    }
+
+    SUBCASE("root-motor-and-matrices")
+    {
+        std::vector<motor<>> world(parents.size(), identity);
+        std::vector<matrix<float, 4, 4>> matrices(parents.size());
+        s.forward_kinematics(span{world}, span{matrices}, span{local}, root_motor);
+        std::vector<motor<>> expected = reference(parents, local, root_motor);
+        for (size_t i = 0; i != world.size(); ++i)
+        {
+            matrix<float, 4, 4> transform = to_matrix<4>(expected[i]);
+            for (size_t j = 0; j != 8; ++j)
+            {
+                CHECK_EQ(world[i][j], doctest::Approx(expected[i][j]).epsilon(1e-4));
+            }
+            for (size_t j = 0; j != 16; ++j)
+            {
+                CHECK_EQ(matrices[i][j], doctest::Approx(transform[j]).epsilon(1e-4));
+            }
+        }
+    }
+
+    SUBCASE("parallel")
+    {
+        // Wide levels are split across the pool, the narrow ones run on the calling thread
+        std::vector<int32_t> wide;
+        for (size_t i = 0; i != 1000; ++i)
+        {
+            wide.push_back(i < 500 ? skeleton::root : static_cast<int32_t>(i % 500));
+        }
+        std::vector<uint32_t> wide_order(wide.size());
+        skeleton crowd{wide, wide_order};
+        std::vector<motor<>> wide_local = local_motors(wide.size());
+
+        thread_pool pool{3};
+        std::vector<motor<>> world(wide.size(), identity);
+        std::vector<matrix<float, 3, 4>> matrices(wide.size());
+        crowd.parallel_forward_kinematics(
+            pool, span{world}, span{matrices}, span{wide_local}, root_motor);
+        std::vector<motor<>> expected = reference(wide, wide_local, root_motor);
+        for (size_t i = 0; i != world.size(); ++i)
+        {
+            matrix<float, 3, 4> transform = to_matrix(expected[i]);
+            for (size_t j = 0; j != 8; ++j)
+            {
+                CHECK_EQ(world[i][j], doctest::Approx(expected[i][j]).epsilon(1e-4));
+            }
+            for (size_t j = 0; j != 12; ++j)
+            {
+                CHECK_EQ(matrices[i][j], doctest::Approx(transform[j]).epsilon(1e-4));
+            }
+        }
+    }
+}
+
+TEST_SUITE_END();
@@ -0,0 +1,128 @@
+#include "test_util.hpp"
+
+#include <doctest/doctest.h>
+#include <gal/skinning.hpp>
+#include <gal/thread_pool.hpp>
+
+#include <vector>
+
+using namespace gal;
+using namespace gal::pga;
+
+TEST_SUITE_BEGIN("skinning");
+
+TEST_CASE("motor-skinning")
+{
+    using pnt = gal::vga::point<float>;
+
+    std::vector<motor<>> joints;
+    for (size_t i = 0; i != 6; ++i)
+    {
+        line<> l{0.1f * i, 0.2f, -0.05f * i, 0.3f * i, -1, 0.5f};
+        joints.push_back(gal::pga::compute([](auto l) { return exp(l); }, l));
+    }
+
+    // 29 vertices exercise both full blocks and the remainder. Weights are deliberately left
+    // unnormalized and some influences are unused.
+    std::vector<skin_influences<>> influences;
+    std::vector<pnt> positions;
+    std::vector<vector<>> normals;
+    for (uint32_t i = 0; i != 29; ++i)
+    {
+        influences.push_back({{i % 6, (i + 1) % 6, (i + 3) % 6, (i + 4) % 6},
+                              {1.0f, 0.1f * (i % 5), 0.5f, i % 2 == 0 ? 0.0f : 0.25f}});
+        positions.emplace_back(0.1f * i, 1.0f - 0.05f * i, 2.0f);
+        normals.emplace_back(0.0f, 0.6f, 0.8f);
+    }
+
+    // Reference: normalize the blended motor, then transform
+    auto expected = [&](size_t v, auto const& x) {
+        std::array<float, 8> blend{};
+        for (size_t k = 0; k != 4; ++k)
+        {
+            for (size_t i = 0; i != 8; ++i)
+            {
+                blend[i] += influences[v].weights[k] * joints[influences[v].joints[k]][i];
+            }
+        }
+        motor<> m{blend[0], blend[1], blend[2], blend[3], blend[4], blend[5], blend[6], blend[7]};
+        m.normalize();
+        return gal::pga::compute([](auto m, auto x) { return m * x * ~m; }, m, x);
+    };
+
+    SUBCASE("positions-and-normals")
+    {
+        std::vector<pnt> out_positions(positions.size(), pnt{0, 0, 0});
+        std::vector<vector<>> out_normals(normals.size(), vector<>{0, 0, 0});
+        skin(span{out_positions},
+             span{out_normals},
+             span{joints},
+             span{influences},
+             span{positions},
+             span{normals});
+
+        for (size_t v = 0; v != positions.size(); ++v)
+        {
+            pnt p{expected(v, positions[v])};
+            vector<> n{expected(v, normals[v])};
+            for (size_t i = 0; i != 3; ++i)
+            {
+                CHECK_EQ(out_positions[v][i], doctest::Approx(p[i]).epsilon(1e-4));
+                CHECK_EQ(out_normals[v][i], doctest::Approx(n[i]).epsilon(1e-4));
+            }
+        }
+    }
+
+    SUBCASE("positions-only")
+    {
+        std::vector<pnt> out_positions(positions.size(), pnt{0, 0, 0});
+        skin(span{out_positions}, span{joints}, span{influences}, span{positions});
+
+        for (size_t v = 0; v != positions.size(); ++v)
+        {
+            pnt p{expected(v, positions[v])};
+            for (size_t i = 0; i != 3; ++i)
+            {
+                CHECK_EQ(out_positions[v][i], doctest::Approx(p[i]).epsilon(1e-4));
+            }
+        }
+    }
+
+    SUBCASE("parallel")
+    {
+        // Replicate the mesh so that several chunks are dispatched
+        std::vector<skin_influences<>> many_influences;
+        std::vector<pnt> many_positions;
+        std::vector<vector<>> many_normals;
+        for (size_t i = 0; i != 500; ++i)
+        {
+            many_influences.push_back(influences[i % influences.size()]);
+            many_positions.push_back(positions[i % positions.size()]);
+            many_normals.push_back(normals[i % normals.size()]);
+        }
+
+        std::vector<pnt> out_positions(many_positions.size(), pnt{0, 0, 0});
+        std::vector<vector<>> out_normals(many_normals.size(), vector<>{0, 0, 0});
+        thread_pool pool{3};
+        parallel_skin(pool,
+                      span{out_positions},
+                      span{out_normals},
+                      span{joints},
+                      span{many_influences},
+                      span{many_positions},
+                      span{many_normals});
+
+        for (size_t v = 0; v != many_positions.size(); ++v)
+        {
+            pnt p{expected(v % positions.size(), positions[v % positions.size()])};
+            vector<> n{expected(v % normals.size(), normals[v % normals.size()])};
+            for (size_t i = 0; i != 3; ++i)
+            {
+                CHECK_EQ(out_positions[v][i], doctest::Approx(p[i]).epsilon(1e-4));
+                CHECK_EQ(out_normals[v][i], doctest::Approx(n[i]).epsilon(1e-4));
+            }
+        }
+    }
+}
+
+TEST_SUITE_END();
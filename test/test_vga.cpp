@@ -136,6 +136,54 @@ TEST_CASE("rotors")
         CHECK_EQ(rotated.y, doctest::Approx(1.0));
         CHECK_EQ(rotated.z, doctest::Approx(0.0));
     }
+
+    SUBCASE("rotor-matrix")
+    {
+        rotor<float> r1{1.2f, 0.6f, 0.0f, 0.8f};
+        vector<float> v1{1, 2, 3};
+
+        vector<float> rotated = compute([](auto r1, auto v1) { return r1 * v1 * ~r1; }, r1, v1);
+        auto m = to_matrix(r1);
+        CHECK_EQ(m(0, 0) + 2 * m(0, 1) + 3 * m(0, 2), doctest::Approx(rotated.x));
+        CHECK_EQ(m(1, 0) + 2 * m(1, 1) + 3 * m(1, 2), doctest::Approx(rotated.y));
+        CHECK_EQ(m(2, 0) + 2 * m(2, 1) + 3 * m(2, 2), doctest::Approx(rotated.z));
+
+        rotor<float> r2 = from_matrix(m);
+        CHECK_EQ(r2.cos_theta, doctest::Approx(r1.cos_theta));
+        CHECK_EQ(r2.sin_theta, doctest::Approx(r1.sin_theta));
+        CHECK_EQ(r2.x, doctest::Approx(r1.x));
+        CHECK_EQ(r2.y, doctest::Approx(r1.y));
+        CHECK_EQ(r2.z, doctest::Approx(r1.z));
+
+        // Rotations by 3 rad have a negative trace, so the quaternion is extracted from the largest
+        // diagonal entry, which is that of the x, y or z axis of rotation (or the z entry for the
+        // arbitrary axis)
+        for (rotor<float> r : {rotor<float>{3.0f, 1.0f, 0.0f, 0.0f},
+                               rotor<float>{3.0f, 0.0f, 1.0f, 0.0f},
+                               rotor<float>{3.0f, 0.0f, 0.0f, 1.0f},
+                               rotor<float>{3.0f, 2.0f / 7.0f, -3.0f / 7.0f, 6.0f / 7.0f}})
+        {
+            auto rm = to_matrix(r);
+            CHECK_LT(rm(0, 0) + rm(1, 1) + rm(2, 2), 0.0f);
+
+            // r and -r encode the same rotation
+            rotor<float> out = from_matrix(rm);
+            float expected[]
+                = {r.cos_theta, r.sin_theta * r.x, r.sin_theta * r.y, r.sin_theta * r.z};
+            float actual[] = {
+                out.cos_theta, out.sin_theta * out.x, out.sin_theta * out.y, out.sin_theta * out.z};
+            float dot = 0.0f;
+            for (size_t i = 0; i != 4; ++i)
+            {
+                dot += expected[i] * actual[i];
+            }
+            float sign = dot < 0 ? -1.0f : 1.0f;
+            for (size_t i = 0; i != 4; ++i)
+            {
+                CHECK_EQ(sign * actual[i], doctest::Approx(expected[i]));
+            }
+        }
+    }
 }
 
 TEST_SUITE_END();